@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -90,6 +91,13 @@ _acb_vec_clear(acb_ptr v, slong n)
     flint_free(v);
 }
 
+/* an acb_struct is laid out as two consecutive arb_structs */
+ACB_INLINE acb_ptr
+acb_scratch_vec(slong n)
+{
+    return (acb_ptr) arb_scratch_vec(2 * n);
+}
+
 ACB_INLINE arb_ptr acb_real_ptr(acb_t z) { return acb_realref(z); }
 ACB_INLINE arb_ptr acb_imag_ptr(acb_t z) { return acb_imagref(z); }
 
@@ -594,6 +602,9 @@ void acb_addmul(acb_t z, const acb_t x, const acb_t y, slong prec);
 
 void acb_submul(acb_t z, const acb_t x, const acb_t y, slong prec);
 
+void acb_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep,
+    acb_srcptr y, slong ystep, slong len, slong prec);
+
 ACB_INLINE void
 acb_addmul_ui(acb_t z, const acb_t x, ulong y, slong prec)
 {
@@ -863,6 +874,14 @@ _acb_vec_set(acb_ptr res, acb_srcptr vec, slong len)
         acb_set(res + i, vec + i);
 }
 
+ACB_INLINE void
+_acb_vec_swap(acb_ptr res, acb_ptr vec, slong len)
+{
+    slong i;
+    for (i = 0; i < len; i++)
+        acb_swap(res + i, vec + i);
+}
+
 ACB_INLINE void
 _acb_vec_set_round(acb_ptr res, acb_srcptr vec, slong len, slong prec)
 {
@@ -1136,6 +1155,8 @@ _acb_vec_get_unique_fmpz_vec(fmpz * res,  acb_srcptr vec, slong len)
 /* sort complex numbers in a nice-to-display order */
 void _acb_vec_sort_pretty(acb_ptr vec, slong len);
 
+void _acb_vec_unit_roots(acb_ptr res, slong len, ulong n, slong prec);
+
 #ifdef __cplusplus
 }
 #endif
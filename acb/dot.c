@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb.h"
+
+void
+acb_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep,
+    acb_srcptr y, slong ystep, slong len, slong prec)
+{
+    arb_ptr a, b, c;
+    arb_t re, im;
+    acb_srcptr xi, yi;
+    slong i;
+
+    if (len <= 0)
+    {
+        if (initial == NULL)
+            acb_zero(res);
+        else
+            acb_set_round(res, initial, prec);
+        return;
+    }
+
+    /* Write the real part as a real dot product of length 2 len between
+       (re x, im x) and (re y, -im y), and the imaginary part as one
+       between (re x, im x) and (im y, re y), using shallow copies. */
+    a = flint_malloc(sizeof(arb_struct) * 6 * len);
+    b = a + 2 * len;
+    c = b + 2 * len;
+
+    for (i = 0; i < len; i++)
+    {
+        xi = x + i * xstep;
+        yi = y + i * ystep;
+
+        a[i] = *acb_realref(xi);
+        a[len + i] = *acb_imagref(xi);
+
+        b[i] = *acb_realref(yi);
+        arf_init_neg_shallow(arb_midref(b + len + i), arb_midref(acb_imagref(yi)));
+        *arb_radref(b + len + i) = *arb_radref(acb_imagref(yi));
+
+        c[i] = *acb_imagref(yi);
+        c[len + i] = *acb_realref(yi);
+    }
+
+    arb_init(re);
+    arb_init(im);
+
+    arb_dot(re, (initial == NULL) ? NULL : acb_realref(initial), subtract,
+        a, 1, b, 1, 2 * len, prec);
+    arb_dot(im, (initial == NULL) ? NULL : acb_imagref(initial), subtract,
+        a, 1, c, 1, 2 * len, prec);
+
+    arb_swap(acb_realref(res), re);
+    arb_swap(acb_imagref(res), im);
+
+    arb_clear(re);
+    arb_clear(im);
+
+    flint_free(a);
+}
+
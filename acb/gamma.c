@@ -20,11 +20,13 @@
 /******************************************************************************
 
     Copyright (C) 2013 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "bernoulli.h"
 #include "acb.h"
+#include "arb_instr.h"
 
 void
 acb_gamma_stirling_choose_param(int * reflect, slong * r, slong * n,
@@ -144,11 +146,13 @@ _acb_gamma(acb_t y, const acb_t x, slong prec, int inverse)
         /* gamma(x) = (rf(1-x, r) * pi) / (gamma(1-x+r) sin(pi x)) */
         acb_sub_ui(t, x, 1, wp);
         acb_neg(t, t);
-        acb_rising_ui_rec(u, t, r, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_RISING, r,
+            acb_rising_ui_rec(u, t, r, wp));
         arb_const_pi(acb_realref(v), wp);
         acb_mul_arb(u, u, acb_realref(v), wp);
         acb_add_ui(t, t, r, wp);
-        acb_gamma_stirling_eval(v, t, n, 0, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_STIRLING, n,
+            acb_gamma_stirling_eval(v, t, n, 0, wp));
         acb_exp(v, v, wp);
         acb_sin_pi(t, x, wp);
         acb_mul(v, v, t, wp);
@@ -157,9 +161,11 @@ _acb_gamma(acb_t y, const acb_t x, slong prec, int inverse)
     {
         /* gamma(x) = gamma(x+r) / rf(x,r) */
         acb_add_ui(t, x, r, wp);
-        acb_gamma_stirling_eval(u, t, n, 0, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_STIRLING, n,
+            acb_gamma_stirling_eval(u, t, n, 0, wp));
         acb_exp(u, u, prec);
-        acb_rising_ui_rec(v, x, r, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_RISING, r,
+            acb_rising_ui_rec(v, x, r, wp));
     }
 
     if (inverse)
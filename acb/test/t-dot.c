@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dot....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        acb_ptr x, y;
+        acb_t s, t, u;
+        slong i, len, prec, ebits;
+        int initial, subtract;
+
+        len = n_randint(state, 5);
+        if (n_randint(state, 4) == 0)
+            len += n_randint(state, 50);
+
+        prec = 2 + n_randint(state, 300);
+        ebits = 1 + n_randint(state, 12);
+        initial = n_randint(state, 2);
+        subtract = n_randint(state, 2);
+
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(len);
+        acb_init(s);
+        acb_init(t);
+        acb_init(u);
+
+        for (i = 0; i < len; i++)
+        {
+            if (n_randint(state, 20) == 0)
+            {
+                acb_randtest_special(x + i, state, 1 + n_randint(state, 400), ebits);
+                acb_randtest_special(y + i, state, 1 + n_randint(state, 400), ebits);
+            }
+            else
+            {
+                acb_randtest(x + i, state, 1 + n_randint(state, 400), ebits);
+                acb_randtest(y + i, state, 1 + n_randint(state, 400), ebits);
+            }
+        }
+
+        acb_randtest(s, state, 1 + n_randint(state, 400), ebits);
+
+        acb_dot(t, initial ? s : NULL, subtract, x, 1, y, 1, len, prec);
+
+        /* compare with repeated multiply-add */
+        if (initial)
+            acb_set(u, s);
+        else
+            acb_zero(u);
+
+        for (i = 0; i < len; i++)
+        {
+            if (subtract)
+                acb_submul(u, x + i, y + i, ARF_PREC_EXACT);
+            else
+                acb_addmul(u, x + i, y + i, ARF_PREC_EXACT);
+        }
+
+        if (acb_is_finite(u) && !acb_overlaps(t, u))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("iter = %wd, len = %wd, prec = %wd\n\n", iter, len, prec);
+            flint_printf("initial = %d, subtract = %d\n\n", initial, subtract);
+            flint_printf("t = "); acb_printd(t, 50); flint_printf("\n\n");
+            flint_printf("u = "); acb_printd(u, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        /* test aliasing of the output with the initial value, and with
+           strided (here reversed) access */
+        if (initial && len > 0)
+        {
+            acb_dot(s, s, subtract, x + len - 1, -1, y + len - 1, -1, len, prec);
+
+            if (acb_is_finite(s) && acb_is_finite(t) && !acb_overlaps(s, t))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("s = "); acb_printd(s, 50); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 50); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, len);
+        acb_clear(s);
+        acb_clear(t);
+        acb_clear(u);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
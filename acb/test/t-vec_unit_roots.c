@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_unit_roots....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        acb_ptr z;
+        acb_t t, u;
+        slong k, len, prec;
+        ulong n;
+
+        n = 1 + n_randint(state, 200);
+        len = n_randint(state, 500);
+        prec = 2 + n_randint(state, 1000);
+
+        z = _acb_vec_init(len);
+        acb_init(t);
+        acb_init(u);
+
+        _acb_vec_unit_roots(z, len, n, prec);
+
+        for (k = 0; k < len; k++)
+        {
+            /* exp(2 pi i k / n) */
+            acb_set_si(t, 2 * k);
+            acb_div_ui(t, t, n, prec + 10);
+            acb_exp_pi_i(t, t, prec);
+
+            /* z^n = 1 */
+            acb_pow_ui(u, z + k, n, prec);
+            acb_sub_ui(u, u, 1, prec);
+
+            if (!acb_overlaps(z + k, t) || !acb_contains_zero(u))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("n = %wu, k = %wd, prec = %wd\n\n", n, k, prec);
+                flint_printf("z = "); acb_printd(z + k, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(z, len);
+        acb_clear(t);
+        acb_clear(u);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb.h"
+
+void
+_acb_vec_unit_roots(acb_ptr res, slong len, ulong n, slong prec)
+{
+    arb_ptr s, c;
+    slong k;
+
+    if (len <= 0)
+        return;
+
+    s = _arb_vec_init(len);
+    c = _arb_vec_init(len);
+
+    _arb_vec_sin_cos_2pi_frac(s, c, len, n, prec);
+
+    for (k = 0; k < len; k++)
+    {
+        arb_swap(acb_realref(res + k), c + k);
+        arb_swap(acb_imagref(res + k), s + k);
+    }
+
+    _arb_vec_clear(s, len);
+    _arb_vec_clear(c, len);
+}
+
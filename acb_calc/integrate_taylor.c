@@ -89,15 +89,17 @@ acb_calc_integrate_taylor(acb_t res,
         /* TODO: exactify m, and include error in x? */
         acb_div_ui(x, delta, 2 * num_steps, prec);
 
+        arb_scratch_begin();
+
         /* compute bounds and number of terms to use */
         {
-            arb_t cbound, xbound, rbound;
+            arb_ptr cbound, xbound, rbound;
             arf_t C, D, R, X, T;
             double DD, TT, NN;
 
-            arb_init(cbound);
-            arb_init(xbound);
-            arb_init(rbound);
+            cbound = arb_scratch_vec(3);
+            xbound = cbound + 1;
+            rbound = cbound + 2;
             arf_init(C);
             arf_init(D);
             arf_init(R);
@@ -171,9 +173,6 @@ acb_calc_integrate_taylor(acb_t res,
                 flint_printf("X: "); arf_printd(X, 15); flint_printf("\n");
             }
 
-            arb_clear(cbound);
-            arb_clear(xbound);
-            arb_clear(rbound);
             arf_clear(C);
             arf_clear(D);
             arf_clear(R);
@@ -182,7 +181,7 @@ acb_calc_integrate_taylor(acb_t res,
         }
 
         /* evaluate Taylor polynomial */
-        taylor_poly = _acb_vec_init(N + 1);
+        taylor_poly = acb_scratch_vec(N + 1);
         func(taylor_poly, m, param, N, prec);
         _acb_poly_integral(taylor_poly, taylor_poly, N + 1, prec);
         _acb_poly_evaluate(y2, taylor_poly, N + 1, x, prec);
@@ -206,7 +205,7 @@ acb_calc_integrate_taylor(acb_t res,
             acb_printd(y2, 15); flint_printf("\n");
         }
 
-        _acb_vec_clear(taylor_poly, N + 1);
+        arb_scratch_end();
 
         if (result == ARB_CALC_NO_CONVERGENCE)
             break;
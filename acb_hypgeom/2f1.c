@@ -20,10 +20,12 @@
 /******************************************************************************
 
     Copyright (C) 2015 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "acb_hypgeom.h"
+#include "arb_instr.h"
 
 static void 
 _acb_hypgeom_2f1r_reduced(acb_t res,
@@ -93,7 +95,8 @@ acb_hypgeom_2f1(acb_t res, const acb_t a, const acb_t b,
     if (acb_is_int(a) && arf_sgn(arb_midref(acb_realref(a))) <= 0 &&
          arf_cmpabs_ui(arb_midref(acb_realref(a)), prec) < 0)
     {
-        acb_hypgeom_2f1_direct(res, a, b, c, z, regularized, prec);
+        ARB_INSTR_TIME(ARB_INSTR_2F1_DIRECT, 0,
+            acb_hypgeom_2f1_direct(res, a, b, c, z, regularized, prec));
         return;
     }
 
@@ -101,7 +104,8 @@ acb_hypgeom_2f1(acb_t res, const acb_t a, const acb_t b,
     if (acb_is_int(b) && arf_sgn(arb_midref(acb_realref(b))) <= 0 &&
          arf_cmpabs_ui(arb_midref(acb_realref(b)), prec) < 0)
     {
-        acb_hypgeom_2f1_direct(res, a, b, c, z, regularized, prec);
+        ARB_INSTR_TIME(ARB_INSTR_2F1_DIRECT, 0,
+            acb_hypgeom_2f1_direct(res, a, b, c, z, regularized, prec));
         return;
     }
 
@@ -115,7 +119,8 @@ acb_hypgeom_2f1(acb_t res, const acb_t a, const acb_t b,
 
         if (acb_is_int(t) && arb_is_nonpositive(acb_realref(t)))
         {
-            acb_hypgeom_2f1_transform(res, a, b, c, z, regularized, 1, prec);
+            ARB_INSTR_TIME(ARB_INSTR_2F1_TRANSFORM, 1,
+                acb_hypgeom_2f1_transform(res, a, b, c, z, regularized, 1, prec));
             acb_clear(t);
             return;
         }
@@ -124,7 +129,8 @@ acb_hypgeom_2f1(acb_t res, const acb_t a, const acb_t b,
 
         if (acb_is_int(t) && arb_is_nonpositive(acb_realref(t)))
         {
-            acb_hypgeom_2f1_transform(res, b, a, c, z, regularized, 1, prec);
+            ARB_INSTR_TIME(ARB_INSTR_2F1_TRANSFORM, 1,
+                acb_hypgeom_2f1_transform(res, b, a, c, z, regularized, 1, prec));
             acb_clear(t);
             return;
         }
@@ -175,17 +181,21 @@ acb_hypgeom_2f1(acb_t res, const acb_t a, const acb_t b,
 
     algorithm = acb_hypgeom_2f1_choose(z);
 
+    /* the total for transformations records which one was used */
     if (algorithm == 0)
     {
-        acb_hypgeom_2f1_direct(res, a, b, c, z, regularized, prec);
+        ARB_INSTR_TIME(ARB_INSTR_2F1_DIRECT, 0,
+            acb_hypgeom_2f1_direct(res, a, b, c, z, regularized, prec));
     }
     else if (algorithm >= 1 && algorithm <= 5)
     {
-        acb_hypgeom_2f1_transform(res, a, b, c, z, regularized, algorithm, prec);
+        ARB_INSTR_TIME(ARB_INSTR_2F1_TRANSFORM, algorithm,
+            acb_hypgeom_2f1_transform(res, a, b, c, z, regularized, algorithm, prec));
     }
     else
     {
-        acb_hypgeom_2f1_corner(res, a, b, c, z, regularized, prec);
+        ARB_INSTR_TIME(ARB_INSTR_2F1_CORNER, 0,
+            acb_hypgeom_2f1_corner(res, a, b, c, z, regularized, prec));
     }
 }
 
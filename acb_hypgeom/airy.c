@@ -20,11 +20,13 @@
 /******************************************************************************
 
     Copyright (C) 2015 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "acb_hypgeom.h"
 #include "double_extras.h"
+#include "arb_instr.h"
 
 #define LOG2 0.69314718055994530942
 #define EXP1 2.7182818284590452354
@@ -272,6 +274,8 @@ acb_hypgeom_airy(acb_t ai, acb_t aip, acb_t bi, acb_t bip, const acb_t z, long p
 
             /* estimate absolute tolerance and necessary working precision */
             abstol = airy_est - wp;
+            if (term_est > airy_est)
+                ARB_INSTR_COUNT(ARB_INSTR_PREC_INCREASE, term_est - airy_est);
             wp = wp + term_est - airy_est;
             wp = FLINT_MAX(wp, 10);
 
@@ -20,10 +20,12 @@
 /******************************************************************************
 
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "acb_hypgeom.h"
+#include "arb_instr.h"
 
 void
 acb_hypgeom_pfq_sum(acb_t s, acb_t t, acb_srcptr a, slong p,
@@ -33,17 +35,21 @@ acb_hypgeom_pfq_sum(acb_t s, acb_t t, acb_srcptr a, slong p,
         && _acb_vec_bits(a, p) * p + _acb_vec_bits(b, q) * q + 10 < prec / 2)
     {
         if (prec >= 256 && acb_bits(z) < prec * 0.01)
-            acb_hypgeom_pfq_sum_bs(s, t, a, p, b, q, z, n, prec);
+            ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_BS, n,
+                acb_hypgeom_pfq_sum_bs(s, t, a, p, b, q, z, n, prec));
         else
-            acb_hypgeom_pfq_sum_rs(s, t, a, p, b, q, z, n, prec);
+            ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_RS, n,
+                acb_hypgeom_pfq_sum_rs(s, t, a, p, b, q, z, n, prec));
     }
     else if (prec >= 1500 && n >= 30 + 100000 / (prec - 1000))
     {
-        acb_hypgeom_pfq_sum_fme(s, t, a, p, b, q, z, n, prec);
+        ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_FME, n,
+            acb_hypgeom_pfq_sum_fme(s, t, a, p, b, q, z, n, prec));
     }
     else
     {
-        acb_hypgeom_pfq_sum_forward(s, t, a, p, b, q, z, n, prec);
+        ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_FORWARD, n,
+            acb_hypgeom_pfq_sum_forward(s, t, a, p, b, q, z, n, prec));
     }
 }
 
@@ -55,17 +61,21 @@ acb_hypgeom_pfq_sum_invz(acb_t s, acb_t t, acb_srcptr a, slong p,
         && _acb_vec_bits(a, p) * p + _acb_vec_bits(b, q) * q + 10 < prec / 2)
     {
         if (prec >= 256 && acb_bits(zinv) < prec * 0.01)
-            acb_hypgeom_pfq_sum_bs_invz(s, t, a, p, b, q, zinv, n, prec);
+            ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_BS, n,
+                acb_hypgeom_pfq_sum_bs_invz(s, t, a, p, b, q, zinv, n, prec));
         else
-            acb_hypgeom_pfq_sum_rs(s, t, a, p, b, q, z, n, prec);
+            ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_RS, n,
+                acb_hypgeom_pfq_sum_rs(s, t, a, p, b, q, z, n, prec));
     }
     else if (prec >= 1500 && n >= 30 + 100000 / (prec - 1000))
     {
-        acb_hypgeom_pfq_sum_fme(s, t, a, p, b, q, z, n, prec);
+        ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_FME, n,
+            acb_hypgeom_pfq_sum_fme(s, t, a, p, b, q, z, n, prec));
     }
     else
     {
-        acb_hypgeom_pfq_sum_forward(s, t, a, p, b, q, z, n, prec);
+        ARB_INSTR_TIME(ARB_INSTR_PFQ_SUM_FORWARD, n,
+            acb_hypgeom_pfq_sum_forward(s, t, a, p, b, q, z, n, prec));
     }
 }
 
@@ -106,11 +106,12 @@ bsplit(acb_t A1, acb_t B1, acb_t C1,
     {
         slong m;
 
-        acb_t A2, B2, C2;
+        acb_ptr A2, B2, C2;
 
-        acb_init(A2);
-        acb_init(B2);
-        acb_init(C2);
+        arb_scratch_begin();
+        A2 = acb_scratch_vec(3);
+        B2 = A2 + 1;
+        C2 = A2 + 2;
 
         m = aa + (bb - aa) / 2;
 
@@ -139,9 +140,7 @@ bsplit(acb_t A1, acb_t B1, acb_t C1,
         acb_mul(A1, A1, A2, prec);
         acb_mul(C1, C1, C2, prec);
 
-        acb_clear(A2);
-        acb_clear(B2);
-        acb_clear(C2);
+        arb_scratch_end();
     }
 }
 
@@ -149,7 +148,7 @@ void
 acb_hypgeom_pfq_sum_bs(acb_t s, acb_t t,
     acb_srcptr a, slong p, acb_srcptr b, slong q, const acb_t z, slong n, slong prec)
 {
-    acb_t u, v, w;
+    acb_ptr u, v, w;
 
     if (n < 4)
     {
@@ -157,46 +156,45 @@ acb_hypgeom_pfq_sum_bs(acb_t s, acb_t t,
         return;
     }
 
-    acb_init(u);
-    acb_init(v);
-    acb_init(w);
+    arb_scratch_begin();
+    u = acb_scratch_vec(3);
+    v = u + 1;
+    w = u + 2;
 
     bsplit(u, v, w, a, p, b, q, z, 0, n, prec, 0);
 
     acb_div(t, u, w, prec);
     acb_div(s, v, w, prec);
 
-    acb_clear(u);
-    acb_clear(v);
-    acb_clear(w);
+    arb_scratch_end();
 }
 
 void
 acb_hypgeom_pfq_sum_bs_invz(acb_t s, acb_t t,
     acb_srcptr a, slong p, acb_srcptr b, slong q, const acb_t z, slong n, slong prec)
 {
-    acb_t u, v, w;
+    acb_ptr u, v, w;
 
     if (n < 4)
     {
-        acb_init(u);
+        arb_scratch_begin();
+        u = acb_scratch_vec(1);
         acb_inv(u, z, prec);
         acb_hypgeom_pfq_sum_forward(s, t, a, p, b, q, u, n, prec);
-        acb_clear(u);
+        arb_scratch_end();
         return;
     }
 
-    acb_init(u);
-    acb_init(v);
-    acb_init(w);
+    arb_scratch_begin();
+    u = acb_scratch_vec(3);
+    v = u + 1;
+    w = u + 2;
 
     bsplit(u, v, w, a, p, b, q, z, 0, n, prec, 1);
 
     acb_div(t, u, w, prec);
     acb_div(s, v, w, prec);
 
-    acb_clear(u);
-    acb_clear(v);
-    acb_clear(w);
+    arb_scratch_end();
 }
 
@@ -51,9 +51,11 @@ evaluate(acb_poly_t A, acb_srcptr a, slong p, const acb_t z, slong n, slong prec
     }
     else if (p == 3)
     {
-        acb_t t, u;
-        acb_init(t);
-        acb_init(u);
+        acb_ptr t, u;
+
+        arb_scratch_begin();
+        t = acb_scratch_vec(2);
+        u = t + 1;
 
         acb_add(t, a + 0, a + 1, prec);
         acb_add(t, t, a + 2, prec);
@@ -88,8 +90,7 @@ evaluate(acb_poly_t A, acb_srcptr a, slong p, const acb_t z, slong n, slong prec
             acb_mul(A->coeffs + 2, A->coeffs + 2, z, prec);
         }
 
-        acb_clear(t);
-        acb_clear(u);
+        arb_scratch_end();
     }
     else if (p != 0)
     {
@@ -174,8 +175,7 @@ acb_hypgeom_pfq_sum_fme(acb_t s, acb_t t,
     const acb_t z, slong n, slong prec)
 {
     acb_poly_t A, B, C;
-    acb_ptr ks, As, Bs, Cs;
-    acb_t u, v;
+    acb_ptr ks, As, Bs, Cs, u, v;
     acb_ptr * tree;
     slong i, k, m, w;
 
@@ -192,13 +192,13 @@ acb_hypgeom_pfq_sum_fme(acb_t s, acb_t t,
     acb_poly_init(B);
     acb_poly_init(C);
 
-    acb_init(u);
-    acb_init(v);
-
-    ks = _acb_vec_init(w);
-    As = _acb_vec_init(w);
-    Bs = _acb_vec_init(w);
-    Cs = _acb_vec_init(w);
+    arb_scratch_begin();
+    u = acb_scratch_vec(4 * w + 2);
+    v = u + 1;
+    ks = u + 2;
+    As = ks + w;
+    Bs = As + w;
+    Cs = Bs + w;
 
     bsplit(A, B, C, a, p, b, q, z, 0, m, prec);
 
@@ -257,13 +257,7 @@ acb_hypgeom_pfq_sum_fme(acb_t s, acb_t t,
         acb_mul(t, t, z, prec);
     }
 
-    acb_clear(u);
-    acb_clear(v);
-
-    _acb_vec_clear(ks, w);
-    _acb_vec_clear(As, w);
-    _acb_vec_clear(Bs, w);
-    _acb_vec_clear(Cs, w);
+    arb_scratch_end();
 
     acb_poly_clear(A);
     acb_poly_clear(B);
@@ -29,11 +29,12 @@ void
 acb_hypgeom_pfq_sum_forward(acb_t s, acb_t t,
     acb_srcptr a, slong p, acb_srcptr b, slong q, const acb_t z, slong n, slong prec)
 {
-    acb_t u, v;
+    acb_ptr u, v;
     slong k, i;
 
-    acb_init(u);
-    acb_init(v);
+    arb_scratch_begin();
+    u = acb_scratch_vec(2);
+    v = u + 1;
 
     acb_zero(s);
     acb_one(t);
@@ -71,7 +72,6 @@ acb_hypgeom_pfq_sum_forward(acb_t s, acb_t t,
         acb_mul(t, t, z, prec);
     }
 
-    acb_clear(u);
-    acb_clear(v);
+    arb_scratch_end();
 }
 
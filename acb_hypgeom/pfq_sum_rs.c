@@ -29,8 +29,7 @@ void
 acb_hypgeom_pfq_sum_rs(acb_t res, acb_t term, acb_srcptr a, slong p,
                                               acb_srcptr b, slong q, const acb_t z, slong n, slong prec)
 {
-    acb_ptr zpow;
-    acb_t s, t, u;
+    acb_ptr zpow, s, t, u;
     slong i, j, k, m;
     mag_t B, C;
 
@@ -49,10 +48,13 @@ acb_hypgeom_pfq_sum_rs(acb_t res, acb_t term, acb_srcptr a, slong p,
 
     mag_init(B);
     mag_init(C);
-    acb_init(s);
-    acb_init(t);
-    acb_init(u);
-    zpow = _acb_vec_init(m + 1);
+    arb_scratch_begin();
+    s = acb_scratch_vec(m + 4);
+    t = s + 1;
+    u = s + 2;
+    zpow = s + 3;
+
+    acb_zero(s);
 
     _acb_vec_set_powers(zpow, z, m + 1, prec);
 
@@ -122,9 +124,6 @@ acb_hypgeom_pfq_sum_rs(acb_t res, acb_t term, acb_srcptr a, slong p,
 
     mag_clear(B);
     mag_clear(C);
-    acb_clear(s);
-    acb_clear(t);
-    acb_clear(u);
-    _acb_vec_clear(zpow, m + 1);
+    arb_scratch_end();
 }
 
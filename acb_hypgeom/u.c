@@ -20,10 +20,12 @@
 /******************************************************************************
 
     Copyright (C) 2015 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "acb_hypgeom.h"
+#include "arb_instr.h"
 
 void
 acb_hypgeom_u_1f1_series(acb_poly_t res,
@@ -188,12 +190,14 @@ acb_hypgeom_u(acb_t res, const acb_t a, const acb_t b, const acb_t z, slong prec
     {
         acb_neg(t, a);
         acb_pow(t, z, t, prec);
-        acb_hypgeom_u_asymp(res, a, b, z, -1, prec);
+        ARB_INSTR_TIME(ARB_INSTR_U_ASYMP, 0,
+            acb_hypgeom_u_asymp(res, a, b, z, -1, prec));
         acb_mul(res, res, t, prec);
     }
     else
     {
-        acb_hypgeom_u_1f1(res, a, b, z, prec);
+        ARB_INSTR_TIME(ARB_INSTR_U_1F1, 0,
+            acb_hypgeom_u_1f1(res, a, b, z, prec));
     }
 
     acb_clear(t);
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -28,7 +29,8 @@
 void
 acb_mat_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
 {
-    slong ar, ac, br, bc, i, j, k;
+    slong ar, ac, br, bc, i, j;
+    acb_ptr BT;
 
     ar = acb_mat_nrows(A);
     ac = acb_mat_ncols(A);
@@ -57,20 +59,17 @@ acb_mat_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
         return;
     }
 
+    /* shallow transpose of B, so that each entry is a contiguous dot product */
+    BT = flint_malloc(sizeof(acb_struct) * br * bc);
+
+    for (i = 0; i < br; i++)
+        for (j = 0; j < bc; j++)
+            BT[j * br + i] = *acb_mat_entry(B, i, j);
+
     for (i = 0; i < ar; i++)
-    {
         for (j = 0; j < bc; j++)
-        {
-            acb_mul(acb_mat_entry(C, i, j),
-                      acb_mat_entry(A, i, 0),
-                      acb_mat_entry(B, 0, j), prec);
-
-            for (k = 1; k < br; k++)
-            {
-                acb_addmul(acb_mat_entry(C, i, j),
-                             acb_mat_entry(A, i, k),
-                             acb_mat_entry(B, k, j), prec);
-            }
-        }
-    }
+            acb_dot(acb_mat_entry(C, i, j), NULL, 0,
+                A->rows[i], 1, BT + j * br, 1, br, prec);
+
+    flint_free(BT);
 }
@@ -267,6 +267,14 @@ void acb_poly_mullow_transpose_gauss(acb_poly_t res, const acb_poly_t poly1,
                                             const acb_poly_t poly2,
                                                 slong n, slong prec);
 
+void _acb_poly_mullow_block(acb_ptr res,
+    acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong n, slong prec);
+
+void acb_poly_mullow_block(acb_poly_t res, const acb_poly_t poly1,
+                                            const acb_poly_t poly2,
+                                                slong n, slong prec);
+
 void _acb_poly_mullow(acb_ptr res,
     acb_srcptr poly1, slong len1,
     acb_srcptr poly2, slong len2, slong n, slong prec);
@@ -275,6 +283,18 @@ void acb_poly_mullow(acb_poly_t res, const acb_poly_t poly1,
                                             const acb_poly_t poly2,
                                                 slong n, slong prec);
 
+void _acb_poly_mulhigh(acb_ptr res, acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong nlo, slong prec);
+
+void acb_poly_mulhigh(acb_poly_t res, const acb_poly_t poly1,
+              const acb_poly_t poly2, slong nlo, slong prec);
+
+void _acb_poly_mulmid(acb_ptr res, acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong nlo, slong nhi, slong prec);
+
+void acb_poly_mulmid(acb_poly_t res, const acb_poly_t poly1,
+              const acb_poly_t poly2, slong nlo, slong nhi, slong prec);
+
 void _acb_poly_mul(acb_ptr C,
     acb_srcptr A, slong lenA,
     acb_srcptr B, slong lenB, slong prec);
@@ -440,6 +460,43 @@ void
 acb_poly_interpolate_fast(acb_poly_t poly,
         acb_srcptr xs, acb_srcptr ys, slong n, slong prec);
 
+/* Precomputed nodes */
+
+typedef struct
+{
+    acb_ptr xs;
+    acb_ptr * tree;
+    acb_ptr weights;
+    slong len;
+}
+acb_poly_nodes_struct;
+
+typedef acb_poly_nodes_struct acb_poly_nodes_t[1];
+
+#define acb_poly_nodes_length(T) ((T)->len)
+
+void acb_poly_nodes_init(acb_poly_nodes_t T, acb_srcptr xs, slong n, slong prec);
+
+void acb_poly_nodes_clear(acb_poly_nodes_t T);
+
+void _acb_poly_nodes_evaluate_vec(acb_ptr ys, acb_srcptr poly, slong plen,
+    const acb_poly_nodes_t T, slong prec);
+
+void acb_poly_nodes_evaluate_vec(acb_ptr ys, const acb_poly_t poly,
+    const acb_poly_nodes_t T, slong prec);
+
+void acb_poly_nodes_evaluate_vec_batch(acb_ptr ys, const acb_poly_struct * polys,
+    slong num, const acb_poly_nodes_t T, slong prec);
+
+void _acb_poly_nodes_interpolate(acb_ptr poly, acb_srcptr ys,
+    const acb_poly_nodes_t T, slong prec);
+
+void acb_poly_nodes_interpolate(acb_poly_t poly, acb_srcptr ys,
+    const acb_poly_nodes_t T, slong prec);
+
+void acb_poly_nodes_evaluate_interpolant(acb_t res, acb_srcptr ys,
+    const acb_poly_nodes_t T, const acb_t t, slong prec);
+
 void
 _acb_poly_interpolate_newton(acb_ptr poly, acb_srcptr xs,
     acb_srcptr ys, slong n, slong prec);
@@ -472,6 +529,21 @@ slong _acb_poly_validate_roots(acb_ptr roots,
 void _acb_poly_refine_roots_durand_kerner(acb_ptr roots,
         acb_srcptr poly, slong len, slong prec);
 
+void _acb_poly_refine_roots_aberth(acb_ptr roots,
+        acb_srcptr poly, slong len, slong prec);
+
+int _acb_poly_refine_roots_aberth_d(acb_ptr roots,
+        acb_srcptr poly, slong len, slong maxiter);
+
+slong _acb_get_mid_mag(const acb_t z);
+
+slong _acb_get_rad_mag(const acb_t z);
+
+void _acb_poly_roots_initial_values(acb_ptr roots, slong deg, slong prec);
+
+void _acb_poly_roots_initial_values_polygon(acb_ptr roots,
+    acb_srcptr poly, slong len, slong prec);
+
 slong _acb_poly_find_roots(acb_ptr roots,
     acb_srcptr poly,
     acb_srcptr initial, slong len, slong maxiter, slong prec);
@@ -81,13 +81,49 @@ _acb_poly_roots_initial_values(acb_ptr roots, slong deg, slong prec)
     }
 }
 
+/* maximum number of iterations in double precision */
+#define ABERTH_D_MAXITER 100
+
+/* precision of the first multiprecision iterations after the
+   double precision iterations */
+#define ABERTH_START_PREC 128
+
+/* one Aberth step at precision wp; returns the magnitude of the largest
+   correction relative to the largest root */
+static slong
+_acb_poly_find_roots_step(acb_ptr roots, acb_srcptr poly, slong len, slong wp)
+{
+    slong i, deg, rootmag, max_rootmag, correction, max_correction;
+
+    deg = len - 1;
+
+    max_rootmag = -ARF_PREC_EXACT;
+    for (i = 0; i < deg; i++)
+    {
+        rootmag = _acb_get_mid_mag(roots + i);
+        max_rootmag = FLINT_MAX(rootmag, max_rootmag);
+    }
+
+    _acb_poly_refine_roots_aberth(roots, poly, len, wp);
+
+    max_correction = -ARF_PREC_EXACT;
+    for (i = 0; i < deg; i++)
+    {
+        correction = _acb_get_rad_mag(roots + i);
+        max_correction = FLINT_MAX(correction, max_correction);
+    }
+
+    /* estimate the correction relative to the whole set of roots */
+    return max_correction - max_rootmag;
+}
+
 slong
 _acb_poly_find_roots(acb_ptr roots,
     acb_srcptr poly,
     acb_srcptr initial, slong len, slong maxiter, slong prec)
 {
-    slong iter, i, deg;
-    slong rootmag, max_rootmag, correction, max_correction;
+    slong iter, i, deg, wp, level_iter, level_maxiter;
+    slong max_correction;
 
     deg = len - 1;
 
@@ -114,33 +150,43 @@ _acb_poly_find_roots(acb_ptr roots,
     }
 
     if (initial == NULL)
-        _acb_poly_roots_initial_values(roots, deg, prec);
+    {
+        /* get approximations accurate to about double precision
+           cheaply, then increase the precision gradually */
+        _acb_poly_roots_initial_values_polygon(roots, poly, len, prec);
+        _acb_poly_refine_roots_aberth_d(roots, poly, len, ABERTH_D_MAXITER);
+        wp = FLINT_MIN(prec, ABERTH_START_PREC);
+    }
     else
+    {
         _acb_vec_set(roots, initial, deg);
+        wp = prec;
+    }
 
-    if (maxiter == 0)
-        maxiter = 2 * deg + n_sqrt(prec);
+    /* the iterations at reduced precision do not count against maxiter;
+       they have their own limit per precision level */
+    level_iter = 0;
+    level_maxiter = FLINT_MAX(4, (2 * deg + n_sqrt(prec)) / 8);
 
-    for (iter = 0; iter < maxiter; iter++)
+    while (wp < prec)
     {
-        max_rootmag = -ARF_PREC_EXACT;
-        for (i = 0; i < deg; i++)
-        {
-            rootmag = _acb_get_mid_mag(roots + i);
-            max_rootmag = FLINT_MAX(rootmag, max_rootmag);
-        }
+        max_correction = _acb_poly_find_roots_step(roots, poly, len, wp);
+        level_iter++;
 
-        _acb_poly_refine_roots_durand_kerner(roots, poly, len, prec);
-
-        max_correction = -ARF_PREC_EXACT;
-        for (i = 0; i < deg; i++)
+        /* the roots are accurate to about wp bits */
+        if (max_correction < -wp / 2 || level_iter >= level_maxiter)
         {
-            correction = _acb_get_rad_mag(roots + i);
-            max_correction = FLINT_MAX(correction, max_correction);
+            wp = FLINT_MIN(2 * wp, prec);
+            level_iter = 0;
         }
+    }
+
+    if (maxiter == 0)
+        maxiter = 2 * deg + n_sqrt(prec);
 
-        /* estimate the correction relative to the whole set of roots */
-        max_correction -= max_rootmag;
+    for (iter = 0; iter < maxiter; iter++)
+    {
+        max_correction = _acb_poly_find_roots_step(roots, poly, len, prec);
 
         /* flint_printf("ITER %wd MAX CORRECTION: %wd\n", iter, max_correction); */
 
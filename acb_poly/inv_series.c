@@ -60,8 +60,8 @@ _acb_poly_inv_series(acb_ptr Qinv,
         Qnlen = FLINT_MIN(Qlen, n);
         Wlen = FLINT_MIN(Qnlen + m - 1, n);
         W2len = Wlen - m;
-        MULLOW(W, Q, Qnlen, Qinv, m, Wlen, prec);
-        MULLOW(Qinv + m, Qinv, m, W + m, W2len, n - m, prec);
+        _acb_poly_mulmid(W, Q, Qnlen, Qinv, m, m, Wlen, prec);
+        MULLOW(Qinv + m, Qinv, m, W, W2len, n - m, prec);
         _acb_vec_neg(Qinv + m, Qinv + m, n - m);
 
         NEWTON_END_LOOP
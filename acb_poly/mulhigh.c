@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_mulhigh(acb_ptr res, acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong nlo, slong prec)
+{
+    slong i, n, rlen1, rlen2;
+    acb_ptr r1, r2;
+
+    n = len1 + len2 - 1 - nlo;
+
+    if (nlo == 0)
+    {
+        if (len1 >= len2)
+            _acb_poly_mullow(res, poly1, len1, poly2, len2, n, prec);
+        else
+            _acb_poly_mullow(res, poly2, len2, poly1, len1, n, prec);
+        return;
+    }
+
+    /* The coefficients nlo, ..., len1 + len2 - 2 of the product are the
+       reversed low coefficients of the product of the reversed inputs,
+       to which only the top n coefficients of each input contribute.
+       The reversed inputs are shallow copies. */
+    rlen1 = FLINT_MIN(len1, n);
+    rlen2 = FLINT_MIN(len2, n);
+
+    r1 = flint_malloc(sizeof(acb_struct) * rlen1);
+    for (i = 0; i < rlen1; i++)
+        r1[i] = poly1[len1 - 1 - i];
+
+    if (poly1 == poly2 && len1 == len2)
+    {
+        r2 = r1;
+    }
+    else
+    {
+        r2 = flint_malloc(sizeof(acb_struct) * rlen2);
+        for (i = 0; i < rlen2; i++)
+            r2[i] = poly2[len2 - 1 - i];
+    }
+
+    if (rlen1 >= rlen2)
+        _acb_poly_mullow(res, r1, rlen1, r2, rlen2, n, prec);
+    else
+        _acb_poly_mullow(res, r2, rlen2, r1, rlen1, n, prec);
+
+    _acb_poly_reverse(res, res, n, n);
+
+    if (r2 != r1)
+        flint_free(r2);
+    flint_free(r1);
+}
+
+void
+acb_poly_mulhigh(acb_poly_t res, const acb_poly_t poly1,
+              const acb_poly_t poly2, slong nlo, slong prec)
+{
+    slong len1, len2, n;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    if (len1 == 0 || len2 == 0 || nlo >= len1 + len2 - 1)
+    {
+        acb_poly_zero(res);
+        return;
+    }
+
+    n = len1 + len2 - 1 - nlo;
+
+    if (res == poly1 || res == poly2)
+    {
+        acb_poly_t t;
+        acb_poly_init2(t, n);
+        _acb_poly_mulhigh(t->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, nlo, prec);
+        acb_poly_swap(res, t);
+        acb_poly_clear(t);
+    }
+    else
+    {
+        acb_poly_fit_length(res, n);
+        _acb_poly_mulhigh(res->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, nlo, prec);
+    }
+
+    _acb_poly_set_length(res, n);
+    _acb_poly_normalise(res);
+}
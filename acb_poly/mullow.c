@@ -20,22 +20,26 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "acb_poly.h"
 
-#define CUTOFF 4
-
 void
 _acb_poly_mullow(acb_ptr res,
     acb_srcptr poly1, slong len1,
     acb_srcptr poly2, slong len2, slong n, slong prec)
 {
-    if (n < CUTOFF || len1 < CUTOFF || len2 < CUTOFF)
+    slong cutoff = arb_tune_get(ARB_TUNE_ACB_POLY_MULLOW_TRANSPOSE, prec);
+    slong block_cutoff = arb_tune_get(ARB_TUNE_ACB_POLY_MULLOW_BLOCK, prec);
+
+    if (n < cutoff || len1 < cutoff || len2 < cutoff)
         _acb_poly_mullow_classical(res, poly1, len1, poly2, len2, n, prec);
-    else
+    else if (n < block_cutoff || len1 < block_cutoff || len2 < block_cutoff)
         _acb_poly_mullow_transpose(res, poly1, len1, poly2, len2, n, prec);
+    else
+        _acb_poly_mullow_block(res, poly1, len1, poly2, len2, n, prec);
 }
 
 void
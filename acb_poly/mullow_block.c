@@ -0,0 +1,581 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+/* the nonzero part of the midpoint of x with the largest exponent */
+static __inline__ arf_srcptr
+_acb_mid_top(const acb_t x)
+{
+    if (arf_is_zero(arb_midref(acb_realref(x))))
+        return arb_midref(acb_imagref(x));
+
+    if (arf_is_zero(arb_midref(acb_imagref(x))))
+        return arb_midref(acb_realref(x));
+
+    if (fmpz_cmp(ARF_EXPREF(arb_midref(acb_realref(x))),
+                 ARF_EXPREF(arb_midref(acb_imagref(x)))) >= 0)
+        return arb_midref(acb_realref(x));
+    else
+        return arb_midref(acb_imagref(x));
+}
+
+static __inline__ int
+_acb_mid_is_zero(const acb_t x)
+{
+    return arf_is_zero(arb_midref(acb_realref(x))) &&
+           arf_is_zero(arb_midref(acb_imagref(x)));
+}
+
+static __inline__ int
+_acb_rad_is_zero(const acb_t x)
+{
+    return mag_is_zero(arb_radref(acb_realref(x))) &&
+           mag_is_zero(arb_radref(acb_imagref(x)));
+}
+
+/* same as _arb_poly_get_scale, using the larger part of each midpoint */
+static void
+_acb_poly_get_scale(fmpz_t scale, acb_srcptr x, slong xlen,
+                                  acb_srcptr y, slong ylen)
+{
+    slong xa, xb, ya, yb, den;
+
+    fmpz_zero(scale);
+
+    xa = 0;
+    xb = xlen - 1;
+    while (xa < xlen && _acb_mid_is_zero(x + xa)) xa++;
+    while (xb > xa && _acb_mid_is_zero(x + xb)) xb--;
+
+    ya = 0;
+    yb = ylen - 1;
+    while (ya < ylen && _acb_mid_is_zero(y + ya)) ya++;
+    while (yb > ya && _acb_mid_is_zero(y + yb)) yb--;
+
+    if (xa <= xb && ya <= yb && (xa < xb || ya < yb))
+    {
+        fmpz_add(scale, scale, ARF_EXPREF(_acb_mid_top(x + xb)));
+        fmpz_sub(scale, scale, ARF_EXPREF(_acb_mid_top(x + xa)));
+        fmpz_add(scale, scale, ARF_EXPREF(_acb_mid_top(y + yb)));
+        fmpz_sub(scale, scale, ARF_EXPREF(_acb_mid_top(y + ya)));
+
+        den = (xb - xa) + (yb - ya);
+
+        fmpz_mul_2exp(scale, scale, 1);
+        fmpz_add_ui(scale, scale, den);
+        fmpz_fdiv_q_ui(scale, scale, 2 * den);
+    }
+}
+
+/* see arb_poly/mullow_block.c */
+#define ALPHA 3.0
+#define BETA 512
+
+/* Writes the midpoints of x as re[j] * 2^(exps[i] + scale * j) and
+   im[j] * 2^(exps[i] + scale * j) for j in block i. The real and
+   imaginary parts share the block structure and the exponents, so that
+   sums of the integer polynomials for the two parts are exact. */
+static void
+_acb_vec_get_fmpz_2exp_blocks(fmpz * re, fmpz * im, fmpz * exps,
+    slong * blocks, const fmpz_t scale, acb_srcptr x, slong len, slong prec)
+{
+    fmpz_t top, bot, t, b, v, block_top, block_bot;
+    slong i, j, k, s, block, maxheight;
+    int in_zero;
+    arf_srcptr m;
+
+    fmpz_init(top);
+    fmpz_init(bot);
+    fmpz_init(t);
+    fmpz_init(b);
+    fmpz_init(v);
+    fmpz_init(block_top);
+    fmpz_init(block_bot);
+
+    blocks[0] = 0;
+    block = 0;
+    in_zero = 1;
+
+    if (prec == ARF_PREC_EXACT)
+        maxheight = ARF_PREC_EXACT;
+    else
+        maxheight = ALPHA * prec + BETA;
+
+    for (i = 0; i < len; i++)
+    {
+        if (_acb_mid_is_zero(x + i))
+            continue;
+
+        /* Bottom and top exponent of current number */
+        fmpz_set(top, ARF_EXPREF(_acb_mid_top(x + i)));
+
+        for (k = 0; k < 2; k++)
+        {
+            m = arb_midref((k == 0) ? acb_realref(x + i) : acb_imagref(x + i));
+
+            if (arf_is_zero(m))
+                continue;
+
+            fmpz_sub_ui(t, ARF_EXPREF(m), arf_bits(m));
+
+            if (k == 0 || arf_is_zero(arb_midref(acb_realref(x + i))))
+                fmpz_set(bot, t);
+            else
+                fmpz_min(bot, bot, t);
+        }
+
+        fmpz_submul_ui(top, scale, i);
+        fmpz_submul_ui(bot, scale, i);
+
+        /* Extend current block. */
+        if (in_zero)
+        {
+            fmpz_swap(block_top, top);
+            fmpz_swap(block_bot, bot);
+        }
+        else
+        {
+            fmpz_max(t, top, block_top);
+            fmpz_min(b, bot, block_bot);
+            fmpz_sub(v, t, b);
+
+            if (fmpz_cmp_ui(v, maxheight) < 0)
+            {
+                fmpz_swap(block_top, t);
+                fmpz_swap(block_bot, b);
+            }
+            else  /* start new block */
+            {
+                fmpz_set(exps + block, block_bot);
+
+                block++;
+                blocks[block] = i;
+
+                fmpz_swap(block_top, top);
+                fmpz_swap(block_bot, bot);
+            }
+        }
+
+        in_zero = 0;
+    }
+
+    /* write exponent for last block */
+    fmpz_set(exps + block, block_bot);
+
+    /* end marker */
+    blocks[block + 1] = len;
+
+    /* write the block data */
+    for (i = 0; blocks[i] != len; i++)
+    {
+        for (j = blocks[i]; j < blocks[i + 1]; j++)
+        {
+            for (k = 0; k < 2; k++)
+            {
+                fmpz * c = (k == 0) ? (re + j) : (im + j);
+                m = arb_midref((k == 0) ? acb_realref(x + j) : acb_imagref(x + j));
+
+                if (arf_is_zero(m))
+                {
+                    fmpz_zero(c);
+                }
+                else
+                {
+                    arf_get_fmpz_2exp(c, bot, m);
+
+                    fmpz_mul_ui(t, scale, j);
+                    fmpz_sub(t, bot, t);
+                    s = _fmpz_sub_small(t, exps + i);
+                    if (s < 0) abort(); /* Bug catcher */
+                    fmpz_mul_2exp(c, c, s);
+                }
+            }
+        }
+    }
+
+    fmpz_clear(top);
+    fmpz_clear(bot);
+    fmpz_clear(t);
+    fmpz_clear(b);
+    fmpz_clear(v);
+    fmpz_clear(block_top);
+    fmpz_clear(block_bot);
+}
+
+static __inline__ void
+_fmpz_poly_mullow_any(fmpz * z, const fmpz * x, slong xl,
+    const fmpz * y, slong yl, slong n)
+{
+    if (xl >= yl)
+        _fmpz_poly_mullow(z, x, xl, y, yl, n);
+    else
+        _fmpz_poly_mullow(z, y, yl, x, xl, n);
+}
+
+/* Adds the product of the midpoints to z. The products of the integer
+   polynomials are exact, so the Gauss combination
+   (a+bi)(c+di) = (ac - bd) + ((a+b)(c+d) - ac - bd)i
+   does not lose accuracy; for squaring, the diagonal blocks use
+   (a+bi)^2 = (a+b)(a-b) + 2abi. */
+static void
+_acb_poly_addmullow_block(acb_ptr z, fmpz * z1, fmpz * z2, fmpz * z3,
+    const fmpz * xre, const fmpz * xim, const fmpz * xsum, const fmpz * xdiff,
+    const fmpz * xexps, const slong * xblocks, slong xlen,
+    const fmpz * yre, const fmpz * yim, const fmpz * ysum,
+    const fmpz * yexps, const slong * yblocks, slong ylen,
+    slong n, slong prec, int squaring)
+{
+    slong i, j, k, xp, yp, xl, yl, bn;
+    fmpz_t zexp;
+
+    fmpz_init(zexp);
+
+    if (squaring)
+    {
+        for (i = 0; (xp = xblocks[i]) != xlen; i++)
+        {
+            if (2 * xp >= n)
+                continue;
+
+            xl = xblocks[i + 1] - xp;
+            bn = FLINT_MIN(2 * xl - 1, n - 2 * xp);
+            xl = FLINT_MIN(xl, bn);
+
+            _fmpz_poly_mullow(z1, xsum + xp, xl, xdiff + xp, xl, bn);
+            _fmpz_poly_mullow(z2, xre + xp, xl, xim + xp, xl, bn);
+
+            _fmpz_add2_fast(zexp, xexps + i, xexps + i, 0);
+
+            for (k = 0; k < bn; k++)
+                arb_add_fmpz_2exp(acb_realref(z + 2 * xp + k),
+                    acb_realref(z + 2 * xp + k), z1 + k, zexp, prec);
+
+            fmpz_add_ui(zexp, zexp, 1);
+
+            for (k = 0; k < bn; k++)
+                arb_add_fmpz_2exp(acb_imagref(z + 2 * xp + k),
+                    acb_imagref(z + 2 * xp + k), z2 + k, zexp, prec);
+        }
+    }
+
+    for (i = 0; (xp = xblocks[i]) != xlen; i++)
+    {
+        for (j = squaring ? i + 1 : 0; (yp = yblocks[j]) != ylen; j++)
+        {
+            if (xp + yp >= n)
+                continue;
+
+            xl = xblocks[i + 1] - xp;
+            yl = yblocks[j + 1] - yp;
+            bn = FLINT_MIN(xl + yl - 1, n - xp - yp);
+            xl = FLINT_MIN(xl, bn);
+            yl = FLINT_MIN(yl, bn);
+
+            _fmpz_poly_mullow_any(z1, xre + xp, xl, yre + yp, yl, bn);
+            _fmpz_poly_mullow_any(z2, xim + xp, xl, yim + yp, yl, bn);
+            _fmpz_poly_mullow_any(z3, xsum + xp, xl, ysum + yp, yl, bn);
+
+            /* z3 = ad + bc, z1 = ac - bd */
+            _fmpz_vec_sub(z3, z3, z1, bn);
+            _fmpz_vec_sub(z3, z3, z2, bn);
+            _fmpz_vec_sub(z1, z1, z2, bn);
+
+            _fmpz_add2_fast(zexp, xexps + i, yexps + j, squaring);
+
+            for (k = 0; k < bn; k++)
+            {
+                arb_add_fmpz_2exp(acb_realref(z + xp + yp + k),
+                    acb_realref(z + xp + yp + k), z1 + k, zexp, prec);
+                arb_add_fmpz_2exp(acb_imagref(z + xp + yp + k),
+                    acb_imagref(z + xp + yp + k), z3 + k, zexp, prec);
+            }
+        }
+    }
+
+    fmpz_clear(zexp);
+}
+
+/* Sets w to balls with zero midpoints whose radii bound the propagated
+   error of both parts of the product. With |a| + |b| <= M, max(r(a),r(b))
+   <= R for the first factor, and similarly for the second, the error is
+   bounded by (Mx + Rx) Ry + Rx (My + Ry). The products of the bounds
+   are computed by _arb_poly_mullow_block applied to balls with zero
+   midpoints, which only does radius arithmetic. */
+static void
+_acb_poly_mullow_block_rad(arb_ptr w, acb_srcptr x, slong xlen,
+    acb_srcptr y, slong ylen, slong n, int xexact, int yexact)
+{
+    arb_ptr u, v, t;
+    mag_t m;
+    slong i;
+
+    u = _arb_vec_init(xlen);
+    v = _arb_vec_init(ylen);
+    t = _arb_vec_init(n);
+    mag_init(m);
+
+    _arb_vec_zero(w, n);
+
+    /* (Mx + Rx) Ry */
+    if (!yexact)
+    {
+        for (i = 0; i < xlen; i++)
+        {
+            arf_get_mag(arb_radref(u + i), arb_midref(acb_realref(x + i)));
+            arf_get_mag(m, arb_midref(acb_imagref(x + i)));
+            mag_add(arb_radref(u + i), arb_radref(u + i), m);
+            mag_max(m, arb_radref(acb_realref(x + i)), arb_radref(acb_imagref(x + i)));
+            mag_add(arb_radref(u + i), arb_radref(u + i), m);
+        }
+
+        for (i = 0; i < ylen; i++)
+            mag_max(arb_radref(v + i), arb_radref(acb_realref(y + i)),
+                arb_radref(acb_imagref(y + i)));
+
+        _arb_poly_mullow_block(t, u, xlen, v, ylen, n, MAG_BITS);
+        _arb_vec_add(w, w, t, n, MAG_BITS);
+    }
+
+    /* Rx (My + Ry) */
+    if (!xexact)
+    {
+        for (i = 0; i < xlen; i++)
+            mag_max(arb_radref(u + i), arb_radref(acb_realref(x + i)),
+                arb_radref(acb_imagref(x + i)));
+
+        for (i = 0; i < ylen; i++)
+        {
+            arf_get_mag(arb_radref(v + i), arb_midref(acb_realref(y + i)));
+            arf_get_mag(m, arb_midref(acb_imagref(y + i)));
+            mag_add(arb_radref(v + i), arb_radref(v + i), m);
+            mag_max(m, arb_radref(acb_realref(y + i)), arb_radref(acb_imagref(y + i)));
+            mag_add(arb_radref(v + i), arb_radref(v + i), m);
+        }
+
+        _arb_poly_mullow_block(t, u, xlen, v, ylen, n, MAG_BITS);
+        _arb_vec_add(w, w, t, n, MAG_BITS);
+    }
+
+    _arb_vec_clear(u, xlen);
+    _arb_vec_clear(v, ylen);
+    _arb_vec_clear(t, n);
+    mag_clear(m);
+}
+
+void
+_acb_poly_mullow_block(acb_ptr z, acb_srcptr x, slong xlen,
+                                acb_srcptr y, slong ylen, slong n, slong prec)
+{
+    slong xmlen, xrlen, ymlen, yrlen, i;
+    fmpz *xre, *xim, *xsum, *xdiff, *yre, *yim, *ysum, *z1, *z2, *z3;
+    fmpz *xe, *ye;
+    slong *xblocks, *yblocks;
+    int squaring;
+    fmpz_t scale, t;
+
+    xlen = FLINT_MIN(xlen, n);
+    ylen = FLINT_MIN(ylen, n);
+
+    squaring = (x == y) && (xlen == ylen);
+
+    /* We don't know how to deal with infinities or NaNs */
+    for (i = 0; i < xlen; i++)
+    {
+        if (!acb_is_finite(x + i))
+        {
+            _acb_poly_mullow_classical(z, x, xlen, y, ylen, n, prec);
+            return;
+        }
+    }
+
+    for (i = 0; i < ylen && !squaring; i++)
+    {
+        if (!acb_is_finite(y + i))
+        {
+            _acb_poly_mullow_classical(z, x, xlen, y, ylen, n, prec);
+            return;
+        }
+    }
+
+    /* Strip trailing zeros */
+    xmlen = xrlen = xlen;
+    while (xmlen > 0 && _acb_mid_is_zero(x + xmlen - 1)) xmlen--;
+    while (xrlen > 0 && _acb_rad_is_zero(x + xrlen - 1)) xrlen--;
+
+    if (squaring)
+    {
+        ymlen = xmlen;
+        yrlen = xrlen;
+    }
+    else
+    {
+        ymlen = yrlen = ylen;
+        while (ymlen > 0 && _acb_mid_is_zero(y + ymlen - 1)) ymlen--;
+        while (yrlen > 0 && _acb_rad_is_zero(y + yrlen - 1)) yrlen--;
+    }
+
+    xlen = FLINT_MAX(xmlen, xrlen);
+    ylen = FLINT_MAX(ymlen, yrlen);
+
+    /* Start with the zero polynomial */
+    _acb_vec_zero(z, n);
+
+    /* Nothing to do */
+    if (xlen == 0 || ylen == 0)
+        return;
+
+    n = FLINT_MIN(n, xlen + ylen - 1);
+
+    /* multiply midpoints */
+    if (xmlen != 0 && ymlen != 0)
+    {
+        fmpz_init(scale);
+        fmpz_init(t);
+        xre = _fmpz_vec_init(xmlen);
+        xim = _fmpz_vec_init(xmlen);
+        xsum = _fmpz_vec_init(xmlen);
+        xdiff = _fmpz_vec_init(xmlen);
+        yre = _fmpz_vec_init(ymlen);
+        yim = _fmpz_vec_init(ymlen);
+        ysum = _fmpz_vec_init(ymlen);
+        z1 = _fmpz_vec_init(n);
+        z2 = _fmpz_vec_init(n);
+        z3 = _fmpz_vec_init(n);
+        xe = _fmpz_vec_init(xmlen);
+        ye = _fmpz_vec_init(ymlen);
+        xblocks = flint_malloc(sizeof(slong) * (xmlen + 1));
+        yblocks = flint_malloc(sizeof(slong) * (ymlen + 1));
+
+        _acb_poly_get_scale(scale, x, xmlen, y, ymlen);
+
+        _acb_vec_get_fmpz_2exp_blocks(xre, xim, xe, xblocks, scale, x, xmlen, prec);
+        _fmpz_vec_add(xsum, xre, xim, xmlen);
+
+        if (squaring)
+        {
+            _fmpz_vec_sub(xdiff, xre, xim, xmlen);
+
+            _acb_poly_addmullow_block(z, z1, z2, z3,
+                xre, xim, xsum, xdiff, xe, xblocks, xmlen,
+                xre, xim, xsum, xe, xblocks, xmlen, n, prec, 1);
+        }
+        else
+        {
+            _acb_vec_get_fmpz_2exp_blocks(yre, yim, ye, yblocks, scale, y, ymlen, prec);
+            _fmpz_vec_add(ysum, yre, yim, ymlen);
+
+            _acb_poly_addmullow_block(z, z1, z2, z3,
+                xre, xim, xsum, NULL, xe, xblocks, xmlen,
+                yre, yim, ysum, ye, yblocks, ymlen, n, prec, 0);
+        }
+
+        /* Unscale. */
+        if (!fmpz_is_zero(scale))
+        {
+            fmpz_zero(t);
+            for (i = 0; i < n; i++)
+            {
+                acb_mul_2exp_fmpz(z + i, z + i, t);
+                fmpz_add(t, t, scale);
+            }
+        }
+
+        _fmpz_vec_clear(xre, xmlen);
+        _fmpz_vec_clear(xim, xmlen);
+        _fmpz_vec_clear(xsum, xmlen);
+        _fmpz_vec_clear(xdiff, xmlen);
+        _fmpz_vec_clear(yre, ymlen);
+        _fmpz_vec_clear(yim, ymlen);
+        _fmpz_vec_clear(ysum, ymlen);
+        _fmpz_vec_clear(z1, n);
+        _fmpz_vec_clear(z2, n);
+        _fmpz_vec_clear(z3, n);
+        _fmpz_vec_clear(xe, xmlen);
+        _fmpz_vec_clear(ye, ymlen);
+        flint_free(xblocks);
+        flint_free(yblocks);
+        fmpz_clear(scale);
+        fmpz_clear(t);
+    }
+
+    /* Error propagation */
+    if (xrlen != 0 || yrlen != 0)
+    {
+        arb_ptr w = _arb_vec_init(n);
+
+        _acb_poly_mullow_block_rad(w, x, xlen, y, ylen, n,
+            xrlen == 0, yrlen == 0);
+
+        for (i = 0; i < n; i++)
+        {
+            mag_add(arb_radref(acb_realref(z + i)),
+                arb_radref(acb_realref(z + i)), arb_radref(w + i));
+            mag_add(arb_radref(acb_imagref(z + i)),
+                arb_radref(acb_imagref(z + i)), arb_radref(w + i));
+        }
+
+        _arb_vec_clear(w, n);
+    }
+}
+
+void
+acb_poly_mullow_block(acb_poly_t res, const acb_poly_t poly1,
+              const acb_poly_t poly2, slong n, slong prec)
+{
+    slong xlen, ylen, zlen;
+
+    xlen = poly1->length;
+    ylen = poly2->length;
+
+    if (xlen == 0 || ylen == 0 || n == 0)
+    {
+        acb_poly_zero(res);
+        return;
+    }
+
+    xlen = FLINT_MIN(xlen, n);
+    ylen = FLINT_MIN(ylen, n);
+    zlen = FLINT_MIN(xlen + ylen - 1, n);
+
+    if (res == poly1 || res == poly2)
+    {
+        acb_poly_t tmp;
+        acb_poly_init2(tmp, zlen);
+        _acb_poly_mullow_block(tmp->coeffs, poly1->coeffs, xlen,
+            poly2->coeffs, ylen, zlen, prec);
+        acb_poly_swap(res, tmp);
+        acb_poly_clear(tmp);
+    }
+    else
+    {
+        acb_poly_fit_length(res, zlen);
+        _acb_poly_mullow_block(res->coeffs, poly1->coeffs, xlen,
+            poly2->coeffs, ylen, zlen, prec);
+    }
+
+    _acb_poly_set_length(res, zlen);
+    _acb_poly_normalise(res);
+}
@@ -21,6 +21,7 @@
 
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -40,35 +41,50 @@ _acb_poly_mullow_classical(acb_ptr res,
     }
     else if (poly1 == poly2 && len1 == len2)
     {
-        slong i;
-
-        _acb_vec_scalar_mul(res, poly1, FLINT_MIN(len1, n), poly1, prec);
-        _acb_vec_scalar_mul(res + len1, poly1 + 1, n - len1, poly1 + len1 - 1, prec);
-
-        for (i = 1; i < len1 - 1; i++)
-            _acb_vec_scalar_addmul(res + i + 1, poly1 + 1,
-                FLINT_MIN(i - 1, n - (i + 1)), poly1 + i, prec);
-
-        for (i = 1; i < FLINT_MIN(2 * len1 - 2, n); i++)
+        slong i, start, stop;
+        acb_t t;
+
+        acb_init(t);
+
+        for (i = 0; i < n; i++)
+        {
+            if (i > 2 * len1 - 2)
+            {
+                acb_zero(res + i);
+                continue;
+            }
+
+            /* the terms poly1[j] poly1[i-j] with j < i-j appear twice;
+               with the exact half square as initial value, the sum is
+               rounded only once and the final doubling is exact */
+            start = FLINT_MAX(0, i - len1 + 1);
+            stop = (i + 1) / 2;
+
+            if (i % 2 == 0)
+            {
+                acb_mul(t, poly1 + i / 2, poly1 + i / 2, ARF_PREC_EXACT);
+                acb_mul_2exp_si(t, t, -1);
+            }
+
+            acb_dot(res + i, (i % 2 == 0) ? t : NULL, 0, poly1 + start, 1,
+                poly1 + i - start, -1, stop - start, prec);
             acb_mul_2exp_si(res + i, res + i, 1);
+        }
 
-        for (i = 1; i < FLINT_MIN(len1 - 1, (n + 1) / 2); i++)
-            acb_addmul(res + 2 * i, poly1 + i, poly1 + i, prec);
+        acb_clear(t);
     }
     else
     {
-        slong i;
-
-        _acb_vec_scalar_mul(res, poly1, FLINT_MIN(len1, n), poly2, prec);
+        slong i, start, stop;
 
-        if (n > len1)
-            _acb_vec_scalar_mul(res + len1, poly2 + 1, n - len1,
-                                      poly1 + len1 - 1, prec);
+        for (i = 0; i < n; i++)
+        {
+            start = FLINT_MAX(0, i - len2 + 1);
+            stop = FLINT_MIN(len1 - 1, i);
 
-        for (i = 0; i < FLINT_MIN(len1, n) - 1; i++)
-            _acb_vec_scalar_addmul(res + i + 1, poly2 + 1,
-                                         FLINT_MIN(len2, n - i) - 1,
-                                         poly1 + i, prec);
+            acb_dot(res + i, NULL, 0, poly1 + start, 1,
+                poly2 + i - start, -1, stop - start + 1, prec);
+        }
     }
 }
 
@@ -0,0 +1,121 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+#define MULLOW(z, x, xn, y, yn, nn, prec) \
+    if ((xn) >= (yn)) \
+        _acb_poly_mullow(z, x, xn, y, yn, nn, prec); \
+    else \
+        _acb_poly_mullow(z, y, yn, x, xn, nn, prec); \
+
+static void
+_acb_poly_mulmid_classical(acb_ptr res, acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong nlo, slong nhi, slong prec)
+{
+    slong i, start, stop;
+
+    for (i = nlo; i < nhi; i++)
+    {
+        start = FLINT_MAX(0, i - len2 + 1);
+        stop = FLINT_MIN(len1 - 1, i);
+
+        acb_dot(res + i - nlo, NULL, 0, poly1 + start, 1,
+            poly2 + i - start, -1, stop - start + 1, prec);
+    }
+}
+
+void
+_acb_poly_mulmid(acb_ptr res, acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong nlo, slong nhi, slong prec)
+{
+    slong len, cutoff;
+    acb_ptr t;
+
+    len1 = FLINT_MIN(len1, nhi);
+    len2 = FLINT_MIN(len2, nhi);
+    len = nhi - nlo;
+
+    if (nlo == 0)
+    {
+        MULLOW(res, poly1, len1, poly2, len2, nhi, prec);
+        return;
+    }
+
+    cutoff = arb_tune_get(ARB_TUNE_ACB_POLY_MULLOW_TRANSPOSE, prec);
+
+    if (len < cutoff || len1 < cutoff || len2 < cutoff)
+    {
+        _acb_poly_mulmid_classical(res, poly1, len1, poly2, len2,
+            nlo, nhi, prec);
+        return;
+    }
+
+    /* The fast multiplication algorithms do not get cheaper when only
+       a window of the coefficients is wanted, so compute the truncated
+       product and keep the window. */
+    t = _acb_vec_init(nhi);
+    MULLOW(t, poly1, len1, poly2, len2, nhi, prec);
+    _acb_vec_swap(res, t + nlo, len);
+    _acb_vec_clear(t, nhi);
+}
+
+void
+acb_poly_mulmid(acb_poly_t res, const acb_poly_t poly1,
+              const acb_poly_t poly2, slong nlo, slong nhi, slong prec)
+{
+    slong len1, len2, len;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+    nhi = FLINT_MIN(nhi, len1 + len2 - 1);
+
+    if (len1 == 0 || len2 == 0 || nlo >= nhi)
+    {
+        acb_poly_zero(res);
+        return;
+    }
+
+    len = nhi - nlo;
+
+    if (res == poly1 || res == poly2)
+    {
+        acb_poly_t t;
+        acb_poly_init2(t, len);
+        _acb_poly_mulmid(t->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, nlo, nhi, prec);
+        acb_poly_swap(res, t);
+        acb_poly_clear(t);
+    }
+    else
+    {
+        acb_poly_fit_length(res, len);
+        _acb_poly_mulmid(res->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, nlo, nhi, prec);
+    }
+
+    _acb_poly_set_length(res, len);
+    _acb_poly_normalise(res);
+}
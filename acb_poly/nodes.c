@@ -0,0 +1,48 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+void
+acb_poly_nodes_init(acb_poly_nodes_t T, acb_srcptr xs, slong n, slong prec)
+{
+    T->len = n;
+    T->xs = _acb_vec_init(n);
+    T->weights = _acb_vec_init(n);
+    T->tree = _acb_poly_tree_alloc(n);
+
+    _acb_vec_set(T->xs, xs, n);
+    _acb_poly_tree_build(T->tree, xs, n, prec);
+    _acb_poly_interpolation_weights(T->weights, T->tree, n, prec);
+}
+
+void
+acb_poly_nodes_clear(acb_poly_nodes_t T)
+{
+    _acb_vec_clear(T->xs, T->len);
+    _acb_vec_clear(T->weights, T->len);
+    _acb_poly_tree_free(T->tree, T->len);
+}
+
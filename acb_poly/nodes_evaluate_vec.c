@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+#include "arb_thread_pool.h"
+
+void
+_acb_poly_nodes_evaluate_vec(acb_ptr ys, acb_srcptr poly, slong plen,
+    const acb_poly_nodes_t T, slong prec)
+{
+    _acb_poly_evaluate_vec_fast_precomp(ys, poly, plen, T->tree, T->len, prec);
+}
+
+void
+acb_poly_nodes_evaluate_vec(acb_ptr ys, const acb_poly_t poly,
+    const acb_poly_nodes_t T, slong prec)
+{
+    _acb_poly_nodes_evaluate_vec(ys, poly->coeffs, poly->length, T, prec);
+}
+
+typedef struct
+{
+    acb_ptr ys;
+    const acb_poly_struct * polys;
+    slong num;
+    const acb_poly_nodes_struct * T;
+    slong prec;
+}
+nodes_evaluate_arg_t;
+
+static void
+_acb_poly_nodes_evaluate_worker(void * arg_ptr)
+{
+    nodes_evaluate_arg_t * arg = (nodes_evaluate_arg_t *) arg_ptr;
+    slong i;
+
+    for (i = 0; i < arg->num; i++)
+        acb_poly_nodes_evaluate_vec(arg->ys + i * arg->T->len,
+            arg->polys + i, arg->T, arg->prec);
+}
+
+void
+acb_poly_nodes_evaluate_vec_batch(acb_ptr ys, const acb_poly_struct * polys,
+    slong num, const acb_poly_nodes_t T, slong prec)
+{
+    nodes_evaluate_arg_t * args;
+    slong i, a, b, num_threads, num_tasks;
+
+    /* the tree is only read, so the polynomials can be evaluated
+       independently */
+    num_threads = flint_get_num_threads();
+    num_tasks = FLINT_MIN(num_threads, num);
+
+    args = flint_malloc(sizeof(nodes_evaluate_arg_t) * FLINT_MAX(num_tasks, 1));
+
+    for (i = 0; i < num_tasks; i++)
+    {
+        a = (num * i) / num_tasks;
+        b = (num * (i + 1)) / num_tasks;
+
+        args[i].ys = ys + a * T->len;
+        args[i].polys = polys + a;
+        args[i].num = b - a;
+        args[i].T = T;
+        args[i].prec = prec;
+    }
+
+    arb_thread_pool_run(_acb_poly_nodes_evaluate_worker, args,
+        sizeof(nodes_evaluate_arg_t), num_tasks);
+
+    flint_free(args);
+}
+
@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_nodes_interpolate(acb_ptr poly, acb_srcptr ys,
+    const acb_poly_nodes_t T, slong prec)
+{
+    _acb_poly_interpolate_fast_precomp(poly, ys, T->tree, T->weights,
+        T->len, prec);
+}
+
+void
+acb_poly_nodes_interpolate(acb_poly_t poly, acb_srcptr ys,
+    const acb_poly_nodes_t T, slong prec)
+{
+    slong n = T->len;
+
+    if (n == 0)
+    {
+        acb_poly_zero(poly);
+    }
+    else
+    {
+        acb_poly_fit_length(poly, n);
+        _acb_poly_set_length(poly, n);
+        _acb_poly_nodes_interpolate(poly->coeffs, ys, T, prec);
+        _acb_poly_normalise(poly);
+    }
+}
+
+void
+acb_poly_nodes_evaluate_interpolant(acb_t res, acb_srcptr ys,
+    const acb_poly_nodes_t T, const acb_t t, slong prec)
+{
+    acb_ptr d, suffix;
+    acb_t s, prefix, u;
+    slong i, n = T->len;
+
+    if (n == 0)
+    {
+        acb_zero(res);
+        return;
+    }
+
+    d = _acb_vec_init(n);
+    suffix = _acb_vec_init(n + 1);
+    acb_init(s);
+    acb_init(prefix);
+    acb_init(u);
+
+    /* p(t) = sum_i y_i w_i prod_{j != i} (t - x_j), with the products
+       over j < i and j > i formed incrementally, so that no division
+       is needed when t is close to one of the nodes */
+    for (i = 0; i < n; i++)
+        acb_sub(d + i, t, T->xs + i, prec);
+
+    acb_one(suffix + n);
+    for (i = n - 1; i > 0; i--)
+        acb_mul(suffix + i, suffix + i + 1, d + i, prec);
+
+    acb_one(prefix);
+    for (i = 0; i < n; i++)
+    {
+        acb_mul(u, ys + i, T->weights + i, prec);
+        acb_mul(u, u, prefix, prec);
+        acb_addmul(s, u, suffix + i + 1, prec);
+        acb_mul(prefix, prefix, d + i, prec);
+    }
+
+    acb_swap(res, s);
+
+    _acb_vec_clear(d, n);
+    _acb_vec_clear(suffix, n + 1);
+    acb_clear(s);
+    acb_clear(prefix);
+    acb_clear(u);
+}
+
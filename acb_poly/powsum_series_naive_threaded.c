@@ -23,8 +23,8 @@
 
 ******************************************************************************/
 
-#include <pthread.h>
 #include "acb_poly.h"
+#include "arb_thread_pool.h"
 
 typedef struct
 {
@@ -40,7 +40,7 @@ typedef struct
 }
 powsum_arg_t;
 
-void *
+void
 _acb_zeta_powsum_evaluator(void * arg_ptr)
 {
     powsum_arg_t arg = *((powsum_arg_t *) arg_ptr);
@@ -131,24 +131,18 @@ _acb_zeta_powsum_evaluator(void * arg_ptr)
     acb_clear(qpow);
     acb_clear(negs);
     arb_clear(f);
-
-    flint_cleanup();
-
-    return NULL;
 }
 
 void
 _acb_poly_powsum_series_naive_threaded(acb_ptr z,
     const acb_t s, const acb_t a, const acb_t q, slong n, slong len, slong prec)
 {
-    pthread_t * threads;
     powsum_arg_t * args;
     slong i, num_threads;
     int split_each_term;
 
     num_threads = flint_get_num_threads();
 
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args = flint_malloc(sizeof(powsum_arg_t) * num_threads);
 
     split_each_term = (len > 1000);
@@ -180,13 +174,10 @@ _acb_poly_powsum_series_naive_threaded(acb_ptr z,
         }
 
         args[i].prec = prec;
-        pthread_create(&threads[i], NULL, _acb_zeta_powsum_evaluator, &args[i]);
     }
 
-    for (i = 0; i < num_threads; i++)
-    {
-        pthread_join(threads[i], NULL);
-    }
+    arb_thread_pool_run(_acb_zeta_powsum_evaluator, args,
+        sizeof(powsum_arg_t), num_threads);
 
     if (!split_each_term)
     {
@@ -198,7 +189,6 @@ _acb_poly_powsum_series_naive_threaded(acb_ptr z,
         }
     }
 
-    flint_free(threads);
     flint_free(args);
 }
 
@@ -0,0 +1,507 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <math.h>
+#include "acb_poly.h"
+#include "arb_thread_pool.h"
+
+/* minimum number of roots per thread */
+#define MIN_CHUNK 16
+
+/* as in refine_roots_durand_kerner.c, we don't need any error bounding,
+   so we use a few helper functions that ignore the radii */
+
+static __inline__ void
+acb_sub_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_sub(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_sub(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_add_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_add(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_add(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_mul_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+#define a arb_midref(acb_realref(x))
+#define b arb_midref(acb_imagref(x))
+#define c arb_midref(acb_realref(y))
+#define d arb_midref(acb_imagref(y))
+#define e arb_midref(acb_realref(z))
+#define f arb_midref(acb_imagref(z))
+
+    arf_complex_mul(e, f, a, b, c, d, prec, ARF_RND_DOWN);
+
+#undef a
+#undef b
+#undef c
+#undef d
+#undef e
+#undef f
+}
+
+static __inline__ void
+acb_inv_mid(acb_t z, const acb_t x, slong prec)
+{
+    arf_t t;
+    arf_init(t);
+
+#define a arb_midref(acb_realref(x))
+#define b arb_midref(acb_imagref(x))
+#define e arb_midref(acb_realref(z))
+#define f arb_midref(acb_imagref(z))
+
+    arf_mul(t, a, a, prec, ARF_RND_DOWN);
+    arf_addmul(t, b, b, prec, ARF_RND_DOWN);
+
+    arf_div(e, a, t, prec, ARF_RND_DOWN);
+    arf_div(f, b, t, prec, ARF_RND_DOWN);
+
+    arf_neg(f, f);
+
+#undef a
+#undef b
+#undef e
+#undef f
+
+    arf_clear(t);
+}
+
+/* sets y = f(a), z = f'(a) */
+static void
+_acb_poly_evaluate2_mid(acb_t y, acb_t z, acb_srcptr f, slong len,
+    const acb_t a, slong prec)
+{
+    slong i;
+    acb_t t;
+
+    acb_init(t);
+    acb_set(y, f + len - 1);
+    acb_zero(z);
+
+    for (i = len - 2; i >= 0; i--)
+    {
+        acb_mul_mid(t, z, a, prec);
+        acb_add_mid(z, t, y, prec);
+        acb_mul_mid(t, y, a, prec);
+        acb_add_mid(y, f + i, t, prec);
+    }
+
+    acb_clear(t);
+}
+
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr roots;
+    acb_srcptr poly;
+    slong len;
+    slong start;
+    slong stop;
+    slong prec;
+}
+aberth_arg_t;
+
+/* computes the corrections w_i = N_i / (1 - N_i sum_{j != i} 1/(z_i - z_j))
+   where N_i = p(z_i) / p'(z_i), for start <= i < stop */
+static void
+_acb_poly_aberth_worker(void * arg_ptr)
+{
+    aberth_arg_t * arg = (aberth_arg_t *) arg_ptr;
+    acb_srcptr roots = arg->roots;
+    slong i, j, deg = arg->len - 1, prec = arg->prec;
+    acb_t p, q, s, t;
+
+    acb_init(p);
+    acb_init(q);
+    acb_init(s);
+    acb_init(t);
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        _acb_poly_evaluate2_mid(p, q, arg->poly, arg->len, roots + i, prec);
+        acb_inv_mid(q, q, prec);
+        acb_mul_mid(p, p, q, prec);
+
+        acb_zero(s);
+        for (j = 0; j < deg; j++)
+        {
+            if (i != j)
+            {
+                acb_sub_mid(t, roots + i, roots + j, prec);
+                acb_inv_mid(t, t, prec);
+                acb_add_mid(s, s, t, prec);
+            }
+        }
+
+        acb_mul_mid(s, s, p, prec);
+        acb_neg(s, s);
+        arf_add_ui(arb_midref(acb_realref(s)),
+            arb_midref(acb_realref(s)), 1, prec, ARF_RND_DOWN);
+        acb_inv_mid(s, s, prec);
+        acb_mul_mid(arg->w + i, p, s, prec);
+    }
+
+    acb_clear(p);
+    acb_clear(q);
+    acb_clear(s);
+    acb_clear(t);
+}
+
+void
+_acb_poly_refine_roots_aberth(acb_ptr roots,
+        acb_srcptr poly, slong len, slong prec)
+{
+    aberth_arg_t * args;
+    acb_ptr w;
+    slong i, deg, num;
+
+    deg = len - 1;
+    w = _acb_vec_init(deg);
+
+    num = FLINT_MIN(flint_get_num_threads(), deg / MIN_CHUNK);
+    num = FLINT_MAX(num, 1);
+
+    args = flint_malloc(sizeof(aberth_arg_t) * num);
+
+    /* all corrections are computed from the old roots (Jacobi style),
+       so the result does not depend on the number of threads */
+    for (i = 0; i < num; i++)
+    {
+        args[i].w = w;
+        args[i].roots = roots;
+        args[i].poly = poly;
+        args[i].len = len;
+        args[i].start = (deg * i) / num;
+        args[i].stop = (deg * (i + 1)) / num;
+        args[i].prec = prec;
+    }
+
+    arb_thread_pool_run(_acb_poly_aberth_worker, args, sizeof(aberth_arg_t), num);
+
+    for (i = 0; i < deg; i++)
+    {
+        acb_sub_mid(roots + i, roots + i, w + i, prec);
+
+        arf_get_mag(arb_radref(acb_realref(roots + i)), arb_midref(acb_realref(w + i)));
+        arf_get_mag(arb_radref(acb_imagref(roots + i)), arb_midref(acb_imagref(w + i)));
+    }
+
+    flint_free(args);
+    _acb_vec_clear(w, deg);
+}
+
+/* Double precision version. The coefficients are scaled by a power of
+   two, and the roots are stored as pairs of doubles. */
+
+/* largest absolute exponent of the roots, and largest range of exponents
+   of the nonzero coefficients, for which we use doubles */
+#define ABERTH_D_MAX_EXP 300
+#define ABERTH_D_COEFF_RANGE 900
+
+/* a root has converged when the correction relative to the root is
+   smaller than ABERTH_D_EPS, or smaller than ABERTH_D_EPS_STALL and no
+   longer decreasing (the limiting accuracy has been reached) */
+#define ABERTH_D_EPS 1e-15
+#define ABERTH_D_EPS_STALL 1e-10
+
+typedef struct
+{
+    double * wr;
+    double * wi;
+    const double * zr;
+    const double * zi;
+    const double * ar;
+    const double * ai;
+    const int * done;
+    slong len;
+    slong start;
+    slong stop;
+}
+aberth_d_arg_t;
+
+/* sets (xr, xi) = p(z) / p'(z) */
+static void
+_aberth_newton_d(double * xr, double * xi, const double * ar,
+    const double * ai, slong len, double zr, double zi)
+{
+    double pr, pi, qr, qi, tr, ti, wr, wi, m;
+    slong k, deg = len - 1;
+    int rev;
+
+    m = zr * zr + zi * zi;
+    rev = (m > 1.0);
+
+    /* for |z| > 1, evaluate the reversed polynomial at w = 1/z, using
+       p(z) / p'(z) = z / (n - w q'(w) / q(w)) where q(w) = w^n p(1/w) */
+    if (rev)
+    {
+        wr = zr / m;
+        wi = -zi / m;
+    }
+    else
+    {
+        wr = zr;
+        wi = zi;
+    }
+
+    pr = rev ? ar[0] : ar[deg];
+    pi = rev ? ai[0] : ai[deg];
+    qr = qi = 0.0;
+
+    for (k = deg - 1; k >= 0; k--)
+    {
+        tr = qr * wr - qi * wi + pr;
+        ti = qr * wi + qi * wr + pi;
+        qr = tr;
+        qi = ti;
+
+        tr = pr * wr - pi * wi + (rev ? ar[deg - k] : ar[k]);
+        ti = pr * wi + pi * wr + (rev ? ai[deg - k] : ai[k]);
+        pr = tr;
+        pi = ti;
+    }
+
+    if (rev)
+    {
+        /* t = w q' / q */
+        m = pr * pr + pi * pi;
+        tr = wr * qr - wi * qi;
+        ti = wr * qi + wi * qr;
+        qr = (tr * pr + ti * pi) / m;
+        qi = (ti * pr - tr * pi) / m;
+
+        /* z / (n - t) */
+        tr = deg - qr;
+        ti = -qi;
+        m = tr * tr + ti * ti;
+        *xr = (zr * tr + zi * ti) / m;
+        *xi = (zi * tr - zr * ti) / m;
+    }
+    else
+    {
+        m = qr * qr + qi * qi;
+        *xr = (pr * qr + pi * qi) / m;
+        *xi = (pi * qr - pr * qi) / m;
+    }
+}
+
+static void
+_acb_poly_aberth_d_worker(void * arg_ptr)
+{
+    aberth_d_arg_t * arg = (aberth_d_arg_t *) arg_ptr;
+    const double * zr = arg->zr;
+    const double * zi = arg->zi;
+    double nr, ni, sr, si, tr, ti, m;
+    slong i, j, deg = arg->len - 1;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        if (arg->done[i])
+            continue;
+
+        _aberth_newton_d(&nr, &ni, arg->ar, arg->ai, arg->len, zr[i], zi[i]);
+
+        sr = si = 0.0;
+        for (j = 0; j < deg; j++)
+        {
+            if (i != j)
+            {
+                tr = zr[i] - zr[j];
+                ti = zi[i] - zi[j];
+                m = tr * tr + ti * ti;
+                sr += tr / m;
+                si -= ti / m;
+            }
+        }
+
+        /* w = N / (1 - N s) */
+        tr = 1.0 - (nr * sr - ni * si);
+        ti = -(nr * si + ni * sr);
+        m = tr * tr + ti * ti;
+        arg->wr[i] = (nr * tr + ni * ti) / m;
+        arg->wi[i] = (ni * tr - nr * ti) / m;
+    }
+}
+
+int
+_acb_poly_refine_roots_aberth_d(acb_ptr roots,
+        acb_srcptr poly, slong len, slong maxiter)
+{
+    aberth_d_arg_t * args;
+    double *ar, *ai, *zr, *zi, *wr, *wi, *prev;
+    double c, r;
+    int *done;
+    slong i, e, emax, deg, num, iter, remaining;
+    int success;
+    arf_t t;
+
+    deg = len - 1;
+    success = 0;
+
+    ar = flint_malloc(sizeof(double) * len);
+    ai = flint_malloc(sizeof(double) * len);
+    zr = flint_malloc(sizeof(double) * deg);
+    zi = flint_malloc(sizeof(double) * deg);
+    wr = flint_malloc(sizeof(double) * deg);
+    wi = flint_malloc(sizeof(double) * deg);
+    prev = flint_malloc(sizeof(double) * deg);
+    done = flint_calloc(deg, sizeof(int));
+    arf_init(t);
+
+    /* check that the coefficients and roots fit */
+    emax = -ARF_PREC_EXACT;
+    for (i = 0; i < len; i++)
+    {
+        if (!arf_is_finite(arb_midref(acb_realref(poly + i))) ||
+            !arf_is_finite(arb_midref(acb_imagref(poly + i))))
+            goto cleanup;
+
+        emax = FLINT_MAX(emax, _acb_get_mid_mag(poly + i));
+    }
+
+    if (emax <= -ARF_PREC_EXACT / 4 || emax >= ARF_PREC_EXACT / 4)
+        goto cleanup;
+
+    for (i = 0; i < len; i++)
+    {
+        e = _acb_get_mid_mag(poly + i);
+
+        if (e != -ARF_PREC_EXACT && e < emax - ABERTH_D_COEFF_RANGE)
+            goto cleanup;
+
+        arf_mul_2exp_si(t, arb_midref(acb_realref(poly + i)), -emax);
+        ar[i] = arf_get_d(t, ARF_RND_NEAR);
+        arf_mul_2exp_si(t, arb_midref(acb_imagref(poly + i)), -emax);
+        ai[i] = arf_get_d(t, ARF_RND_NEAR);
+    }
+
+    for (i = 0; i < deg; i++)
+    {
+        e = _acb_get_mid_mag(roots + i);
+
+        if (e == -ARF_PREC_EXACT || e < -ABERTH_D_MAX_EXP || e > ABERTH_D_MAX_EXP)
+            goto cleanup;
+
+        zr[i] = arf_get_d(arb_midref(acb_realref(roots + i)), ARF_RND_NEAR);
+        zi[i] = arf_get_d(arb_midref(acb_imagref(roots + i)), ARF_RND_NEAR);
+    }
+
+    num = FLINT_MIN(flint_get_num_threads(), deg / MIN_CHUNK);
+    num = FLINT_MAX(num, 1);
+
+    args = flint_malloc(sizeof(aberth_d_arg_t) * num);
+
+    for (i = 0; i < num; i++)
+    {
+        args[i].wr = wr;
+        args[i].wi = wi;
+        args[i].zr = zr;
+        args[i].zi = zi;
+        args[i].ar = ar;
+        args[i].ai = ai;
+        args[i].done = done;
+        args[i].len = len;
+        args[i].start = (deg * i) / num;
+        args[i].stop = (deg * (i + 1)) / num;
+    }
+
+    for (i = 0; i < deg; i++)
+        prev[i] = HUGE_VAL;
+
+    remaining = deg;
+
+    for (iter = 0; iter < maxiter && remaining != 0; iter++)
+    {
+        arb_thread_pool_run(_acb_poly_aberth_d_worker, args,
+            sizeof(aberth_d_arg_t), num);
+
+        for (i = 0; i < deg; i++)
+        {
+            if (done[i])
+                continue;
+
+            zr[i] -= wr[i];
+            zi[i] -= wi[i];
+
+            if (!(fabs(zr[i]) < 1e100 && fabs(zi[i]) < 1e100))
+            {
+                flint_free(args);
+                goto cleanup;
+            }
+
+            c = fabs(wr[i]) + fabs(wi[i]);
+            r = fabs(zr[i]) + fabs(zi[i]);
+
+            if (c <= ABERTH_D_EPS * r ||
+                (c <= ABERTH_D_EPS_STALL * r && c >= 0.25 * prev[i]))
+            {
+                done[i] = 1;
+                remaining--;
+            }
+
+            prev[i] = c;
+        }
+    }
+
+    flint_free(args);
+
+    for (i = 0; i < deg; i++)
+    {
+        arf_set_d(arb_midref(acb_realref(roots + i)), zr[i]);
+        arf_set_d(arb_midref(acb_imagref(roots + i)), zi[i]);
+        mag_zero(arb_radref(acb_realref(roots + i)));
+        mag_zero(arb_radref(acb_imagref(roots + i)));
+    }
+
+    success = (remaining == 0);
+
+cleanup:
+    flint_free(ar);
+    flint_free(ai);
+    flint_free(zr);
+    flint_free(zi);
+    flint_free(wr);
+    flint_free(wi);
+    flint_free(prev);
+    flint_free(done);
+    arf_clear(t);
+
+    return success;
+}
+
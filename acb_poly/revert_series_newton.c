@@ -30,7 +30,7 @@
 void
 _acb_poly_revert_series_newton(acb_ptr Qinv, acb_srcptr Q, slong Qlen, slong n, slong prec)
 {
-    slong i, k, a[FLINT_BITS];
+    slong i, k, h, a[FLINT_BITS];
     acb_ptr T, U, V;
 
     if (n <= 2)
@@ -57,14 +57,17 @@ _acb_poly_revert_series_newton(acb_ptr Qinv, acb_srcptr Q, slong Qlen, slong n,
 
     for (i--; i >= 0; i--)
     {
+        h = k;
         k = a[i];
         _acb_poly_compose_series(T, Q, FLINT_MIN(Qlen, k), Qinv, k, k, prec);
         _acb_poly_derivative(U, T, k, prec); acb_zero(U + k - 1);
-        acb_zero(T + 1);
-        _acb_poly_div_series(V, T, k, U, k, k, prec);
+
+        /* Q(Qinv) = x + O(x^h), so the correction V Qinv' = O(x^h) and
+           only its coefficients h, ..., k - 1 need to be computed */
+        _acb_poly_div_series(V, T + h, k - h, U, k - h, k - h, prec);
         _acb_poly_derivative(T, Qinv, k, prec);
-        _acb_poly_mullow(U, V, k, T, k, k, prec);
-        _acb_vec_sub(Qinv, Qinv, U, k, prec);
+        _acb_poly_mullow(U, V, k - h, T, k - h, k - h, prec);
+        _acb_vec_sub(Qinv + h, Qinv + h, U, k - h, prec);
     }
 
     _acb_vec_clear(T, n);
@@ -0,0 +1,174 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <math.h>
+#include "acb_poly.h"
+
+#define PI 3.141592653589793238462643
+
+/* angular offset of the starting points, to avoid symmetric
+   configurations such as points on the real axis */
+#define SIGMA 0.7
+
+/* Sets l to an approximation of log2 of the absolute value of the
+   midpoint of z. Returns 0 if the midpoint is zero, -1 if it is not
+   finite or has a huge exponent, and 1 otherwise. */
+static int
+_acb_log2_abs_mid(double * l, const acb_t z)
+{
+    const arf_struct * x;
+    double t;
+    slong e;
+    int k, nonzero;
+    arf_t u;
+
+    nonzero = 0;
+    *l = 0.0;
+    arf_init(u);
+
+    for (k = 0; k < 2; k++)
+    {
+        x = (k == 0) ? arb_midref(acb_realref(z)) : arb_midref(acb_imagref(z));
+
+        if (arf_is_zero(x))
+            continue;
+
+        if (!arf_is_finite(x))
+        {
+            nonzero = -1;
+            break;
+        }
+
+        e = arf_abs_bound_lt_2exp_si(x);
+
+        if (e <= -ARF_PREC_EXACT / 4 || e >= ARF_PREC_EXACT / 4)
+        {
+            nonzero = -1;
+            break;
+        }
+
+        arf_mul_2exp_si(u, x, -e);
+        t = e + log(fabs(arf_get_d(u, ARF_RND_NEAR))) * 1.4426950408889634074;
+
+        if (nonzero == 0 || t > *l)
+            *l = t;
+
+        nonzero = 1;
+    }
+
+    arf_clear(u);
+    return nonzero;
+}
+
+/* sets z = 2^lr * exp(i theta) */
+static void
+_acb_set_polar_2exp(acb_t z, double lr, double theta)
+{
+    slong e = (slong) floor(lr);
+    double r = pow(2.0, lr - e);
+
+    arf_set_d(arb_midref(acb_realref(z)), r * cos(theta));
+    arf_set_d(arb_midref(acb_imagref(z)), r * sin(theta));
+    arf_mul_2exp_si(arb_midref(acb_realref(z)), arb_midref(acb_realref(z)), e);
+    arf_mul_2exp_si(arb_midref(acb_imagref(z)), arb_midref(acb_imagref(z)), e);
+    mag_zero(arb_radref(acb_realref(z)));
+    mag_zero(arb_radref(acb_imagref(z)));
+}
+
+void
+_acb_poly_roots_initial_values_polygon(acb_ptr roots,
+    acb_srcptr poly, slong len, slong prec)
+{
+    double * l;
+    double lr, lmin;
+    slong * hull;
+    slong i, j, k, m, t, deg, num, count, first;
+
+    deg = len - 1;
+    l = flint_malloc(sizeof(double) * len);
+    hull = flint_malloc(sizeof(slong) * len);
+
+    /* upper convex hull of the points (i, log2 |a_i|) with a_i != 0 */
+    num = 0;
+    first = -1;
+
+    for (i = 0; i < len; i++)
+    {
+        k = _acb_log2_abs_mid(l + i, poly + i);
+
+        if (k == 0)
+            continue;
+
+        if (k < 0)
+        {
+            _acb_poly_roots_initial_values(roots, deg, prec);
+            goto cleanup;
+        }
+
+        if (first < 0)
+            first = i;
+
+        while (num >= 2 &&
+            (hull[num - 1] - hull[num - 2]) * (l[i] - l[hull[num - 2]]) -
+            (l[hull[num - 1]] - l[hull[num - 2]]) * (i - hull[num - 2]) >= 0)
+        {
+            num--;
+        }
+
+        hull[num++] = i;
+    }
+
+    /* each edge from i to k of the hull gives k - i points on a circle
+       whose radius is the geometric mean of the corresponding roots */
+    count = first;
+    lmin = 0.0;
+
+    for (j = 0; j + 1 < num; j++)
+    {
+        i = hull[j];
+        k = hull[j + 1];
+        m = k - i;
+        lr = (l[i] - l[k]) / m;
+
+        if (j == 0 || lr < lmin)
+            lmin = lr;
+
+        for (t = 0; t < m; t++)
+        {
+            _acb_set_polar_2exp(roots + count,
+                lr, 2 * PI * t / m + 2 * PI * i / deg + SIGMA);
+            count++;
+        }
+    }
+
+    /* roots at zero; put them on a circle well inside the others */
+    for (i = 0; i < first; i++)
+        _acb_set_polar_2exp(roots + i, lmin - 10, 2 * PI * i / first + SIGMA);
+
+cleanup:
+    flint_free(l);
+    flint_free(hull);
+}
+
@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+static int
+_vec_equal(acb_srcptr x, acb_srcptr y, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        if (!acb_equal(x + i, y + i))
+            return 0;
+
+    return 1;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("find_roots_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        acb_poly_t A;
+        acb_ptr xs, roots, roots2;
+        slong i, j, deg, isolated, isolated2, prec;
+        int found;
+
+        deg = 1 + n_randint(state, 80);
+        prec = 30 + n_randint(state, 500);
+
+        acb_poly_init(A);
+        xs = _acb_vec_init(deg);
+        roots = _acb_vec_init(deg);
+        roots2 = _acb_vec_init(deg);
+
+        /* distinct Gaussian integers */
+        for (i = 0; i < deg; i++)
+        {
+            do {
+                acb_set_si_si(xs + i, (slong) n_randint(state, 41) - 20,
+                    (slong) n_randint(state, 41) - 20);
+
+                found = 0;
+                for (j = 0; j < i; j++)
+                    found |= acb_equal(xs + i, xs + j);
+
+            } while (found);
+        }
+
+        /* the coefficients are computed exactly */
+        acb_poly_product_roots(A, xs, deg, 4000);
+
+        flint_set_num_threads(1);
+        isolated = acb_poly_find_roots(roots, A, NULL, 0, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        isolated2 = acb_poly_find_roots(roots2, A, NULL, 0, prec);
+
+        flint_set_num_threads(1);
+
+        if (isolated != isolated2 || !_vec_equal(roots, roots2, deg))
+        {
+            flint_printf("FAIL: result depends on the number of threads\n");
+            flint_printf("deg = %wd, prec = %wd\n\n", deg, prec);
+            abort();
+        }
+
+        /* each isolated root contains one of the known roots */
+        for (j = 0; j < isolated; j++)
+        {
+            found = 0;
+            for (i = 0; i < deg; i++)
+                found |= acb_contains(roots + j, xs + i);
+
+            if (!found)
+            {
+                flint_printf("FAIL: isolated root does not contain a root\n");
+                flint_printf("deg = %wd, prec = %wd\n\n", deg, prec);
+                acb_printd(roots + j, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        acb_poly_clear(A);
+        _acb_vec_clear(xs, deg);
+        _acb_vec_clear(roots, deg);
+        _acb_vec_clear(roots2, deg);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
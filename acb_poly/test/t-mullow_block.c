@@ -0,0 +1,237 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "acb_poly.h"
+
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mullow_block....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with fmpq_poly */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        slong qbits1, qbits2, rbits1, rbits2, rbits3, trunc;
+        fmpq_poly_t A, B, C;
+        acb_poly_t a, b, c, d;
+
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 200);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+        trunc = n_randint(state, 10);
+
+        fmpq_poly_init(A);
+        fmpq_poly_init(B);
+        fmpq_poly_init(C);
+
+        acb_poly_init(a);
+        acb_poly_init(b);
+        acb_poly_init(c);
+        acb_poly_init(d);
+
+        fmpq_poly_randtest(A, state, 1 + n_randint(state, 10), qbits1);
+        fmpq_poly_randtest(B, state, 1 + n_randint(state, 10), qbits2);
+
+        fmpq_poly_mullow(C, A, B, trunc);
+
+        acb_poly_set_fmpq_poly(a, A, rbits1);
+        acb_poly_set_fmpq_poly(b, B, rbits2);
+
+        acb_poly_mullow_block(c, a, b, trunc, rbits3);
+
+        if (!acb_poly_contains_fmpq_poly(c, C))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("bits3 = %wd\n", rbits3);
+            flint_printf("trunc = %wd\n", trunc);
+
+            flint_printf("A = "); fmpq_poly_print(A); flint_printf("\n\n");
+            flint_printf("B = "); fmpq_poly_print(B); flint_printf("\n\n");
+            flint_printf("C = "); fmpq_poly_print(C); flint_printf("\n\n");
+
+            flint_printf("a = "); acb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); acb_poly_printd(c, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        acb_poly_set(d, a);
+        acb_poly_mullow_block(d, d, b, trunc, rbits3);
+        if (!acb_poly_equal(d, c))
+        {
+            flint_printf("FAIL (aliasing 1)\n\n");
+            abort();
+        }
+
+        acb_poly_set(d, b);
+        acb_poly_mullow_block(d, a, d, trunc, rbits3);
+        if (!acb_poly_equal(d, c))
+        {
+            flint_printf("FAIL (aliasing 2)\n\n");
+            abort();
+        }
+
+        /* test squaring */
+        acb_poly_set(b, a);
+        acb_poly_mullow_block(c, a, b, trunc, rbits3);
+        acb_poly_mullow_block(d, a, a, trunc, rbits3);
+        if (!acb_poly_overlaps(c, d))  /* not guaranteed to be identical */
+        {
+            flint_printf("FAIL (squaring)\n\n");
+
+            flint_printf("a = "); acb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); acb_poly_printd(c, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        acb_poly_mullow_block(a, a, a, trunc, rbits3);
+        if (!acb_poly_equal(d, a))
+        {
+            flint_printf("FAIL (aliasing, squaring)\n\n");
+
+            flint_printf("a = "); acb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("d = "); acb_poly_printd(d, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        fmpq_poly_clear(A);
+        fmpq_poly_clear(B);
+        fmpq_poly_clear(C);
+
+        acb_poly_clear(a);
+        acb_poly_clear(b);
+        acb_poly_clear(c);
+        acb_poly_clear(d);
+    }
+
+    /* compare with classical */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        slong bits, trunc;
+        acb_poly_t a, b, ab, ab2;
+
+        bits = 2 + n_randint(state, 200);
+        trunc = n_randint(state, 30);
+
+        acb_poly_init(a);
+        acb_poly_init(b);
+        acb_poly_init(ab);
+        acb_poly_init(ab2);
+
+        acb_poly_randtest(a, state, 1 + n_randint(state, 30), bits, 5);
+        acb_poly_randtest(b, state, 1 + n_randint(state, 30), bits, 5);
+
+        if (n_randint(state, 2))
+            acb_poly_set(b, a);
+
+        acb_poly_mullow_classical(ab, a, b, trunc, bits);
+        acb_poly_mullow_block(ab2, a, b, trunc, bits);
+
+        if (!acb_poly_overlaps(ab, ab2))
+        {
+            flint_printf("FAIL (overlap)\n\n");
+            flint_printf("bits = %wd\n", bits);
+            flint_printf("trunc = %wd\n", trunc);
+
+            flint_printf("a = "); acb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("ab = "); acb_poly_printd(ab, 15); flint_printf("\n\n");
+            flint_printf("ab2 = "); acb_poly_printd(ab2, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        acb_poly_clear(a);
+        acb_poly_clear(b);
+        acb_poly_clear(ab);
+        acb_poly_clear(ab2);
+    }
+
+    /* exact products of exact input must be accurate */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        slong bits, len, k;
+        acb_poly_t a, b, ab, ab2;
+
+        bits = 2 + n_randint(state, 500);
+        len = 1 + n_randint(state, 30);
+
+        acb_poly_init(a);
+        acb_poly_init(b);
+        acb_poly_init(ab);
+        acb_poly_init(ab2);
+
+        for (k = 0; k < len; k++)
+        {
+            acb_t t;
+            acb_init(t);
+            arb_randtest_exact(acb_realref(t), state, bits, 10);
+            arb_randtest_exact(acb_imagref(t), state, bits, 10);
+            acb_poly_set_coeff_acb(a, k, t);
+            arb_randtest_exact(acb_realref(t), state, bits, 10);
+            arb_randtest_exact(acb_imagref(t), state, bits, 10);
+            acb_poly_set_coeff_acb(b, k, t);
+            acb_clear(t);
+        }
+
+        acb_poly_mullow_classical(ab, a, b, 2 * len, ARF_PREC_EXACT);
+        acb_poly_mullow_block(ab2, a, b, 2 * len, ARF_PREC_EXACT);
+
+        if (!acb_poly_equal(ab, ab2))
+        {
+            flint_printf("FAIL (exact)\n\n");
+            flint_printf("a = "); acb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); acb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("ab = "); acb_poly_printd(ab, 15); flint_printf("\n\n");
+            flint_printf("ab2 = "); acb_poly_printd(ab2, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        acb_poly_clear(a);
+        acb_poly_clear(b);
+        acb_poly_clear(ab);
+        acb_poly_clear(ab2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -96,6 +97,14 @@ _arb_vec_clear(arb_ptr v, slong n)
     flint_free(v);
 }
 
+void arb_scratch_begin(void);
+
+void arb_scratch_end(void);
+
+arb_ptr arb_scratch_vec(slong n);
+
+void arb_scratch_cleanup(void);
+
 ARB_INLINE void
 arb_set_fmprb(arb_t x, const fmprb_t y)
 {
@@ -581,6 +590,12 @@ void arb_submul_si(arb_t z, const arb_t x, slong y, slong prec);
 void arb_submul_ui(arb_t z, const arb_t x, ulong y, slong prec);
 void arb_submul_fmpz(arb_t z, const arb_t x, const fmpz_t y, slong prec);
 
+void arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
+    arb_srcptr y, slong ystep, slong len, slong prec);
+
+int _arb_dot_add_term(mp_ptr sum, mp_size_t sn, slong bottom, mp_ptr tmp,
+    mp_srcptr P, mp_size_t pn, slong e, int negative);
+
 void arb_div(arb_t z, const arb_t x, const arb_t y, slong prec);
 void arb_div_arf(arb_t z, const arb_t x, const arf_t y, slong prec);
 void arb_div_si(arb_t z, const arb_t x, slong y, slong prec);
@@ -628,8 +643,10 @@ void arb_log(arb_t z, const arb_t x, slong prec);
 void arb_log_arf(arb_t z, const arf_t x, slong prec);
 void arb_log_ui(arb_t z, ulong x, slong prec);
 void arb_log_fmpz(arb_t z, const fmpz_t x, slong prec);
+void arb_log_fmpq(arb_t z, const fmpq_t x, slong prec);
 void arb_log1p(arb_t r, const arb_t z, slong prec);
 void arb_exp(arb_t z, const arb_t x, slong prec);
+void arb_exp_fmpq(arb_t z, const fmpq_t x, slong prec);
 void arb_expm1(arb_t z, const arb_t x, slong prec);
 void arb_exp_invexp(arb_t z, arb_t w, const arb_t x, slong prec);
 void arb_sin(arb_t s, const arb_t x, slong prec);
@@ -656,6 +673,7 @@ void arb_tanh(arb_t y, const arb_t x, slong prec);
 void arb_coth(arb_t y, const arb_t x, slong prec);
 void arb_atan_arf(arb_t z, const arf_t x, slong prec);
 void arb_atan(arb_t z, const arb_t x, slong prec);
+void arb_atan_fmpq(arb_t z, const fmpq_t x, slong prec);
 void arb_atan2(arb_t z, const arb_t b, const arb_t a, slong prec);
 void arb_asin(arb_t z, const arb_t x, slong prec);
 void arb_acos(arb_t z, const arb_t x, slong prec);
@@ -730,9 +748,28 @@ void arb_bell_sum_taylor(arb_t res, const fmpz_t n, const fmpz_t a, const fmpz_t
 void arb_bell_sum_bsplit(arb_t res, const fmpz_t n, const fmpz_t a, const fmpz_t b, const fmpz_t mmag, slong prec);
 void arb_bell_fmpz(arb_t res, const fmpz_t n, slong prec);
 
+/* process-wide cache behind the thread-local one; a zero-initialized
+   struct is a valid empty cache. A thread-local precision of -1 means
+   initialized but empty, so that a nested call made while the value is
+   being fetched does not initialize it twice. */
+typedef struct arb_const_cache_struct
+{
+    arb_struct value;
+    slong prec;
+    slong readers;
+    int computing;
+    const void * computing_thread;
+    struct arb_const_cache_struct * next;
+}
+arb_const_cache_struct;
+
+slong _arb_const_cache_fetch(arb_t res, arb_const_cache_struct * cache,
+    void (*comp_func)(arb_t, slong), const char * name, slong prec);
+
 #define ARB_DEF_CACHED_CONSTANT(name, comp_func) \
     TLS_PREFIX slong name ## _cached_prec = 0; \
     TLS_PREFIX arb_t name ## _cached_value; \
+    static arb_const_cache_struct name ## _shared_cache; \
     void name ## _cleanup(void) \
     { \
         arb_clear(name ## _cached_value); \
@@ -746,13 +783,61 @@ void arb_bell_fmpz(arb_t res, const fmpz_t n, slong prec);
             { \
                 arb_init(name ## _cached_value); \
                 flint_register_cleanup_function(name ## _cleanup); \
+                name ## _cached_prec = -1; \
             } \
-            comp_func(name ## _cached_value, prec + 32); \
-            name ## _cached_prec = prec; \
+            name ## _cached_prec = _arb_const_cache_fetch( \
+                name ## _cached_value, &name ## _shared_cache, comp_func, \
+                #name, prec); \
         } \
         arb_set_round(x, name ## _cached_value, prec); \
     }
 
+/* tuning parameters */
+
+#define ARB_TUNE_TIERS 5
+
+typedef enum
+{
+    ARB_TUNE_POLY_MULLOW_BLOCK,
+    ARB_TUNE_ACB_POLY_MULLOW_TRANSPOSE,
+    ARB_TUNE_ACB_POLY_MULLOW_BLOCK,
+    ARB_TUNE_EXP_SINH_TERMS,
+    ARB_TUNE_SIN_COS_SQRT_TERMS,
+    ARB_TUNE_MAT_MUL_BLOCK,
+    ARB_TUNE_MAT_MUL_THREADED_WORK,
+    ARB_TUNE_FMPQ_BS_BITS,
+    ARB_TUNE_NUM
+}
+arb_tune_param_t;
+
+extern slong arb_tune_tab[ARB_TUNE_NUM][ARB_TUNE_TIERS];
+
+ARB_INLINE int
+arb_tune_tier(slong prec)
+{
+    if (prec <= 128) return 0;
+    if (prec <= 512) return 1;
+    if (prec <= 2048) return 2;
+    if (prec <= 8192) return 3;
+    return 4;
+}
+
+ARB_INLINE slong
+arb_tune_get(arb_tune_param_t param, slong prec)
+{
+    return arb_tune_tab[param][arb_tune_tier(prec)];
+}
+
+void arb_tune_set(arb_tune_param_t param, slong prec, slong value);
+
+void arb_tune_reset(void);
+
+const char * arb_tune_param_name(arb_tune_param_t param);
+
+int arb_tune_load(const char * filename);
+
+int arb_tune_save(const char * filename);
+
 /* vector functions */
 
 ARB_INLINE arb_ptr
@@ -823,32 +908,14 @@ _arb_vec_neg(arb_ptr B, arb_srcptr A, slong n)
         arb_neg(B + i, A + i);
 }
 
-ARB_INLINE void
-_arb_vec_sub(arb_ptr C, arb_srcptr A,
-    arb_srcptr B, slong n, slong prec)
-{
-    slong i;
-    for (i = 0; i < n; i++)
-        arb_sub(C + i, A + i, B + i, prec);
-}
+void _arb_vec_sub(arb_ptr C, arb_srcptr A,
+    arb_srcptr B, slong n, slong prec);
 
-ARB_INLINE void
-_arb_vec_add(arb_ptr C, arb_srcptr A,
-    arb_srcptr B, slong n, slong prec)
-{
-    slong i;
-    for (i = 0; i < n; i++)
-        arb_add(C + i, A + i, B + i, prec);
-}
+void _arb_vec_add(arb_ptr C, arb_srcptr A,
+    arb_srcptr B, slong n, slong prec);
 
-ARB_INLINE void
-_arb_vec_scalar_mul(arb_ptr res, arb_srcptr vec,
-    slong len, const arb_t c, slong prec)
-{
-    slong i;
-    for (i = 0; i < len; i++)
-        arb_mul(res + i, vec + i, c, prec);
-}
+void _arb_vec_scalar_mul(arb_ptr res, arb_srcptr vec,
+    slong len, const arb_t c, slong prec);
 
 ARB_INLINE void
 _arb_vec_scalar_div(arb_ptr res, arb_srcptr vec,
@@ -892,19 +959,13 @@ _arb_vec_scalar_addmul(arb_ptr res, arb_srcptr vec,
 ARB_INLINE void
 _arb_vec_dot(arb_t res, arb_srcptr vec1, arb_srcptr vec2, slong len2, slong prec)
 {
-    slong i;
-    arb_zero(res);
-    for (i = 0; i < len2; i++)
-        arb_addmul(res, vec1 + i, vec2 + i, prec);
+    arb_dot(res, NULL, 0, vec1, 1, vec2, 1, len2, prec);
 }
 
 ARB_INLINE void
 _arb_vec_norm(arb_t res, arb_srcptr vec, slong len, slong prec)
 {
-    slong i;
-    arb_zero(res);
-    for (i = 0; i < len; i++)
-        arb_addmul(res, vec + i, vec + i, prec);
+    arb_dot(res, NULL, 0, vec, 1, vec, 1, len, prec);
 }
 
 ARB_INLINE void
@@ -970,13 +1031,7 @@ _arb_vec_add_error_arf_vec(arb_ptr res, arf_srcptr err, slong len)
         arb_add_error_arf(res + i, err + i);
 }
 
-ARB_INLINE void
-_arb_vec_add_error_mag_vec(arb_ptr res, mag_srcptr err, slong len)
-{
-    slong i;
-    for (i = 0; i < len; i++)
-        mag_add(arb_radref(res + i), arb_radref(res + i), err + i);
-}
+void _arb_vec_add_error_mag_vec(arb_ptr res, mag_srcptr err, slong len);
 
 ARB_INLINE void
 _arb_vec_indeterminate(arb_ptr vec, slong len)
@@ -1004,6 +1059,19 @@ _arb_vec_get_unique_fmpz_vec(fmpz * res,  arb_srcptr vec, slong len)
     return 1;
 }
 
+void _arb_vec_exp(arb_ptr res, arb_srcptr x, slong len, slong prec);
+
+void _arb_vec_log(arb_ptr res, arb_srcptr x, slong len, slong prec);
+
+void _arb_vec_sin_cos(arb_ptr res_sin, arb_ptr res_cos,
+    arb_srcptr x, slong len, slong prec);
+
+void _arb_vec_sin_cos_2pi_frac(arb_ptr res_sin, arb_ptr res_cos, slong len,
+    ulong n, slong prec);
+
+void _arb_vec_sin_cos_pi_frac(arb_ptr res_sin, arb_ptr res_cos, slong len,
+    ulong n, slong prec);
+
 /* arctangent implementation */
 
 #define ARB_ATAN_TAB1_BITS 8
@@ -1151,6 +1219,35 @@ void _arb_atan_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
 
 void arb_atan_arf_bb(arb_t z, const arf_t x, slong prec);
 
+/* argument reduction tables generated at runtime (above 4608 bits) */
+
+#define ARB_RTAB_BITS 5
+#define ARB_RTAB_NUM (1 << ARB_RTAB_BITS)
+#define ARB_RTAB_EXP_LEVELS 3
+#define ARB_RTAB_ATAN_LEVELS 2
+#define ARB_RTAB_DEFAULT_MAX_PREC 65536
+
+typedef struct
+{
+    slong prec;
+    int have_exp;
+    int have_atan;
+    arb_ptr exp_tab;
+    arb_ptr atan_tab;
+    arb_struct log2;
+}
+arb_rtab_struct;
+
+void arb_rtab_set_max_prec(slong prec);
+
+slong arb_rtab_max_prec(void);
+
+const arb_rtab_struct * _arb_rtab_get(slong prec, int atan);
+
+void arb_exp_arf_rtab(arb_t z, const arf_t x, slong prec, int minus_one);
+
+void arb_atan_arf_rtab(arb_t z, const arf_t x, slong prec);
+
 #ifdef __cplusplus
 }
 #endif
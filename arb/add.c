@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012-2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -30,6 +31,17 @@ arb_add(arb_t z, const arb_t x, const arb_t y, slong prec)
 {
     int inexact;
 
+    if (ARB_IS_LAGOM(x) && ARB_IS_LAGOM(y) && ARB_IS_LAGOM(z))
+    {
+        inexact = _arf_add_fast(arb_midref(z), arb_midref(x), arb_midref(y),
+            0, prec, ARB_RND);
+
+        mag_fast_add(arb_radref(z), arb_radref(x), arb_radref(y));
+        if (inexact)
+            arf_mag_fast_add_ulp(arb_radref(z), arb_radref(z), arb_midref(z), prec);
+        return;
+    }
+
     inexact = arf_add(arb_midref(z), arb_midref(x), arb_midref(y), prec, ARB_RND);
 
     mag_add(arb_radref(z), arb_radref(x), arb_radref(y));
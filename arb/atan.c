@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012-2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -179,7 +180,7 @@ arb_atan_arf(arb_t z, const arf_t x, slong prec)
         /* Too high precision to use table */
         if (wp > ARB_ATAN_TAB2_PREC)
         {
-            arb_atan_arf_bb(z, x, prec);
+            arb_atan_arf_rtab(z, x, prec);
             return;
         }
 
@@ -0,0 +1,137 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+void
+arb_atan_arf_rtab(arb_t z, const arf_t x, slong prec)
+{
+    const arb_rtab_struct * tab;
+    slong mag, wp, i, k;
+    int negative, inverse;
+    arb_t y, s, t, u;
+    arf_t c;
+    fmpz_t q;
+
+    if (arf_is_zero(x))
+    {
+        arb_zero(z);
+        return;
+    }
+
+    mag = arf_abs_bound_lt_2exp_si(x);
+
+    wp = prec + 10 + 2 * FLINT_BIT_COUNT(prec);
+    if (mag < 0)
+        wp += (-mag);
+
+    /* the tables only help if x or 1/x has some leading bits left */
+    if (FLINT_ABS(mag) >= ARB_RTAB_BITS * ARB_RTAB_ATAN_LEVELS
+        || (tab = _arb_rtab_get(wp, 1)) == NULL)
+    {
+        arb_atan_arf_bb(z, x, prec);
+        return;
+    }
+
+    arb_init(y);
+    arb_init(s);
+    arb_init(t);
+    arb_init(u);
+    arf_init(c);
+    fmpz_init(q);
+
+    negative = ARF_SGNBIT(x);
+    inverse = (mag > 0);
+
+    /* 0 <= y <= 1, with atan(|x|) = pi/2 - atan(1/|x|) if |x| >= 1 */
+    arb_set_arf(y, x);
+    if (negative)
+        arb_neg(y, y);
+    if (inverse)
+        arb_ui_div(y, 1, y, wp);
+
+    /* atan(y) = atan(c) + atan((y - c) / (1 + c y)), with c = k / 2^(5i)
+       taken from the leading bits of y at level i */
+    for (i = 0; i < ARB_RTAB_ATAN_LEVELS; i++)
+    {
+        arf_mul_2exp_si(c, arb_midref(y), ARB_RTAB_BITS * (i + 1));
+        arf_get_fmpz(q, c, ARF_RND_FLOOR);
+
+        if (fmpz_sgn(q) <= 0)
+            continue;
+
+        if (fmpz_cmp_si(q, ARB_RTAB_NUM - 1) > 0)
+            k = ARB_RTAB_NUM - 1;
+        else
+            k = fmpz_get_si(q);
+
+        arf_set_si_2exp_si(c, k, -ARB_RTAB_BITS * (i + 1));
+
+        arb_mul_arf(u, y, c, wp);
+        arb_add_ui(u, u, 1, wp);
+        arb_sub_arf(t, y, c, wp);
+        arb_div(y, t, u, wp);
+
+        arb_add(s, s, tab->atan_tab + i * ARB_RTAB_NUM + k, wp);
+    }
+
+    /* atan(m) where m = mid(y); |atan(m) - m| <= |m|^3 if m is negligible */
+    if (arf_is_zero(arb_midref(y)))
+    {
+        arb_zero(t);
+    }
+    else if (arf_cmpabs_2exp_si(arb_midref(y), -wp) < 0)
+    {
+        arf_set(arb_midref(t), arb_midref(y));
+        mag_set_ui_2exp_si(arb_radref(t), 1, -wp);
+    }
+    else
+    {
+        arb_atan_arf_bb(t, arb_midref(y), wp);
+    }
+
+    /* |atan'| <= 1 */
+    mag_add(arb_radref(t), arb_radref(t), arb_radref(y));
+    arb_add(s, s, t, wp);
+
+    if (inverse)
+    {
+        arb_const_pi(t, wp);
+        arb_mul_2exp_si(t, t, -1);
+        arb_sub(s, t, s, wp);
+    }
+
+    if (negative)
+        arb_neg(s, s);
+
+    arb_set_round(z, s, prec);
+
+    arb_clear(y);
+    arb_clear(s);
+    arb_clear(t);
+    arb_clear(u);
+    arf_clear(c);
+    fmpz_clear(q);
+}
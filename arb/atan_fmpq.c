@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+#include "hypgeom.h"
+
+void
+arb_atan_fmpq(arb_t res, const fmpq_t x, slong prec)
+{
+    const fmpz * a;
+    const fmpz * b;
+    slong wp;
+    int inverse, cmp;
+
+    if (fmpq_is_zero(x))
+    {
+        arb_zero(res);
+        return;
+    }
+
+    cmp = fmpz_cmpabs(fmpq_numref(x), fmpq_denref(x));
+
+    if (cmp == 0)
+    {
+        /* atan(+/- 1) = +/- pi/4 */
+        arb_const_pi(res, prec);
+        arb_mul_2exp_si(res, res, -2);
+        if (fmpz_sgn(fmpq_numref(x)) < 0)
+            arb_neg(res, res);
+        return;
+    }
+
+    /* atan(x) = sgn(x) pi/2 - atan(1/x) with |1/x| < 1 */
+    inverse = (cmp > 0);
+    a = inverse ? fmpq_denref(x) : fmpq_numref(x);
+    b = inverse ? fmpq_numref(x) : fmpq_denref(x);
+
+    if ((slong) (fmpz_bits(a) + fmpz_bits(b)) >
+            arb_tune_get(ARB_TUNE_FMPQ_BS_BITS, prec) ||
+        fmpz_bits(a) + 1 >= fmpz_bits(b))
+    {
+        arb_t t;
+        arb_init(t);
+        arb_set_fmpq(t, x, prec + 4);
+        arb_atan(res, t, prec);
+        arb_clear(t);
+    }
+    else
+    {
+        /* now |a/b| < 1/2 */
+        hypgeom_t series;
+        arb_t t, u;
+        fmpz_t c;
+
+        wp = prec + FLINT_BIT_COUNT(prec) + 10;
+
+        arb_init(t);
+        arb_init(u);
+        fmpz_init(c);
+        hypgeom_init(series);
+
+        /* atan(z) = z sum of (-z^2)^k / (2k+1) */
+        fmpz_poly_set_str(series->A, "1  1");
+        fmpz_poly_set_str(series->B, "2  1 2");
+        fmpz_mul(c, a, a);
+        fmpz_neg(c, c);
+        fmpz_poly_set_fmpz(series->P, c);
+        fmpz_mul(c, b, b);
+        fmpz_poly_set_fmpz(series->Q, c);
+
+        arb_hypgeom_infsum(res, t, series, wp, wp);
+        arb_mul_fmpz(res, res, a, wp);
+        arb_mul_fmpz(t, t, b, wp);
+        arb_div(res, res, t, wp);
+
+        if (inverse)
+        {
+            arb_const_pi(u, wp);
+            arb_mul_2exp_si(u, u, -1);
+            if (fmpz_sgn(b) < 0)
+                arb_neg(u, u);
+            arb_sub(res, u, res, wp);
+        }
+
+        arb_set_round(res, res, prec);
+
+        hypgeom_clear(series);
+        arb_clear(t);
+        arb_clear(u);
+        fmpz_clear(c);
+    }
+}
+
@@ -20,11 +20,13 @@
 /******************************************************************************
 
     Copyright (C) 2015 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "arb.h"
 #include "arb_poly.h"
+#include "arb_instr.h"
 
 /* tuning parameter */
 #define RADIUS_BITS 3
@@ -196,6 +198,7 @@ _arb_bell_sum_taylor(arb_t res, const fmpz_t n,
                     break;
             }
 
+            ARB_INSTR_COUNT(ARB_INSTR_PREC_INCREASE, wp);
             wp = 2 * wp;
         }
 
@@ -0,0 +1,185 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "arb.h"
+#include "arb_disk_cache.h"
+
+/*
+    Second-level cache for the constants defined with
+    ARB_DEF_CACHED_CONSTANT. Each thread keeps its own copy of a constant;
+    when a thread needs more precision than its copy has, it takes the
+    value from the shared cache if that is precise enough. Otherwise,
+    one thread computes the constant to the requested precision and
+    replaces the shared value, while other threads asking for more
+    precision than is available wait for it.
+
+    Readers copy the shared value, rounded to the precision they asked
+    for, without holding the lock; the count of active readers keeps the
+    writer from replacing the value underneath them. The shared values
+    are freed when the last thread that has used the cache calls
+    flint_cleanup().
+
+    The thread computing a constant may, while waiting for the thread
+    pool, run a task that asks for the same constant at a higher
+    precision. That call computes the value itself instead of waiting
+    for the upgrade in progress, which would never finish.
+
+    At high precision, values are also read from and written to the
+    disk cache if it has been enabled (see arb_disk_cache.h).
+*/
+
+static pthread_mutex_t arb_const_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t arb_const_cache_cond = PTHREAD_COND_INITIALIZER;
+static arb_const_cache_struct * arb_const_cache_list = NULL;
+static slong arb_const_cache_users = 0;
+
+FLINT_TLS_PREFIX int arb_const_cache_have_registered_cleanup = 0;
+
+/* only the address matters; it identifies the calling thread */
+FLINT_TLS_PREFIX char arb_const_cache_thread_tag;
+
+static void
+_arb_const_cache_cleanup(void)
+{
+    arb_const_cache_struct * c, * next;
+
+    pthread_mutex_lock(&arb_const_cache_mutex);
+
+    arb_const_cache_users--;
+
+    if (arb_const_cache_users == 0)
+    {
+        for (c = arb_const_cache_list; c != NULL; c = next)
+        {
+            next = c->next;
+            arb_clear(&c->value);
+            arb_init(&c->value);
+            c->prec = 0;
+            c->next = NULL;
+        }
+
+        arb_const_cache_list = NULL;
+    }
+
+    pthread_mutex_unlock(&arb_const_cache_mutex);
+
+    arb_const_cache_have_registered_cleanup = 0;
+}
+
+slong
+_arb_const_cache_fetch(arb_t res, arb_const_cache_struct * cache,
+    void (*comp_func)(arb_t, slong), const char * name, slong prec)
+{
+    arb_t t;
+    slong disk_prec, res_prec;
+
+    pthread_mutex_lock(&arb_const_cache_mutex);
+
+    if (!arb_const_cache_have_registered_cleanup)
+    {
+        arb_const_cache_users++;
+        arb_const_cache_have_registered_cleanup = 1;
+        flint_register_cleanup_function(_arb_const_cache_cleanup);
+    }
+
+    if (cache->computing && cache->prec < prec &&
+        cache->computing_thread == &arb_const_cache_thread_tag)
+    {
+        pthread_mutex_unlock(&arb_const_cache_mutex);
+        comp_func(res, prec + 32);
+        return prec;
+    }
+
+    /* wait for an upgrade in progress; it may be precise enough */
+    while (cache->prec < prec && cache->computing)
+        pthread_cond_wait(&arb_const_cache_cond, &arb_const_cache_mutex);
+
+    if (cache->prec >= prec)
+    {
+        cache->readers++;
+        prec = FLINT_MIN(cache->prec, prec + 32);
+        pthread_mutex_unlock(&arb_const_cache_mutex);
+
+        arb_set_round(res, &cache->value, prec);
+
+        pthread_mutex_lock(&arb_const_cache_mutex);
+        cache->readers--;
+        if (cache->readers == 0)
+            pthread_cond_broadcast(&arb_const_cache_cond);
+        pthread_mutex_unlock(&arb_const_cache_mutex);
+
+        return prec;
+    }
+
+    cache->computing = 1;
+    cache->computing_thread = &arb_const_cache_thread_tag;
+    pthread_mutex_unlock(&arb_const_cache_mutex);
+
+    /* computed in a temporary, since a nested call from this thread
+       (see above) may write to res meanwhile */
+    arb_init(t);
+    res_prec = prec;
+
+    /* at high precision, try the disk cache (if enabled) first */
+    if (prec >= ARB_DISK_CACHE_MIN_PREC &&
+        arb_disk_cache_load_arb(t, &disk_prec, name) && disk_prec >= prec)
+    {
+        prec = disk_prec;
+        res_prec = FLINT_MIN(disk_prec, res_prec + 32);
+        arb_set_round(res, t, res_prec);
+    }
+    else
+    {
+        comp_func(t, prec + 32);
+
+        if (prec >= ARB_DISK_CACHE_MIN_PREC)
+            arb_disk_cache_save_arb(t, prec, name);
+
+        arb_set(res, t);
+    }
+
+    pthread_mutex_lock(&arb_const_cache_mutex);
+
+    while (cache->readers != 0)
+        pthread_cond_wait(&arb_const_cache_cond, &arb_const_cache_mutex);
+
+    arb_swap(&cache->value, t);
+
+    if (cache->prec == 0)
+    {
+        cache->next = arb_const_cache_list;
+        arb_const_cache_list = cache;
+    }
+
+    cache->prec = prec;
+    cache->computing = 0;
+    pthread_cond_broadcast(&arb_const_cache_cond);
+    pthread_mutex_unlock(&arb_const_cache_mutex);
+
+    arb_clear(t);
+
+    return res_prec;
+}
@@ -0,0 +1,343 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+#define TMP_ALLOC_LIMBS(size) TMP_ALLOC((size) * sizeof(mp_limb_t))
+
+/* used for special values and huge exponents */
+static void
+_arb_dot_naive(arb_t res, const arb_t initial, int subtract,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec)
+{
+    arb_t s;
+    slong i;
+
+    arb_init(s);
+
+    if (initial != NULL)
+        arb_set(s, initial);
+
+    for (i = 0; i < len; i++)
+    {
+        if (subtract)
+            arb_submul(s, x + i * xstep, y + i * ystep, prec);
+        else
+            arb_addmul(s, x + i * xstep, y + i * ystep, prec);
+    }
+
+    arb_swap(res, s);
+    arb_clear(s);
+}
+
+/*
+    Adds (or subtracts) the term P * 2^(e - FLINT_BITS * pn) to the
+    two's complement fixed-point number {sum, sn} whose least significant
+    bit has weight 2^bottom. Bits below the window are discarded;
+    returns 1 if this happened (the error is then bounded by 2^bottom)
+    and 0 otherwise. The caller guarantees 2^e <= 2^top.
+*/
+int
+_arb_dot_add_term(mp_ptr sum, mp_size_t sn, slong bottom, mp_ptr tmp,
+    mp_srcptr P, mp_size_t pn, slong e, int negative)
+{
+    slong shift;
+    mp_size_t off, tn;
+    mp_srcptr t;
+    int truncated;
+
+    /* |term| < 2^e <= 2^bottom */
+    if (e <= bottom)
+        return 1;
+
+    shift = e - (slong) pn * FLINT_BITS - bottom;
+
+    if (shift >= 0)
+    {
+        off = shift / FLINT_BITS;
+        shift = shift % FLINT_BITS;
+
+        if (shift == 0)
+        {
+            t = P;
+            tn = pn;
+        }
+        else
+        {
+            tmp[pn] = mpn_lshift(tmp, P, pn, shift);
+            t = tmp;
+            tn = pn + 1;
+        }
+
+        truncated = 0;
+    }
+    else
+    {
+        mp_size_t limbs;
+
+        shift = -shift;
+        limbs = shift / FLINT_BITS;
+        shift = shift % FLINT_BITS;
+        off = 0;
+        tn = pn - limbs;
+
+        if (shift == 0)
+        {
+            t = P + limbs;
+        }
+        else
+        {
+            mpn_rshift(tmp, P + limbs, tn, shift);
+            t = tmp;
+        }
+
+        truncated = 1;
+    }
+
+    /* strip high zero limbs; whatever remains fits in the window */
+    while (tn > 0 && t[tn - 1] == 0)
+        tn--;
+
+    if (tn != 0)
+    {
+        if (negative)
+            mpn_sub(sum + off, sum + off, sn - off, t, tn);
+        else
+            mpn_add(sum + off, sum + off, sn - off, t, tn);
+    }
+
+    return truncated;
+}
+
+void
+arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
+    arb_srcptr y, slong ystep, slong len, slong prec)
+{
+    slong i, e, max_exp, min_exp, top, bottom, width, padding, err_count, fix;
+    mp_size_t xn, yn, sn, n;
+    mp_srcptr xptr, yptr;
+    mp_ptr sum, tmp, prod;
+    arb_srcptr xi, yi;
+    int negative, inexact;
+    mag_t rad, xm, ym;
+    TMP_INIT;
+
+    if (len <= 0)
+    {
+        if (initial == NULL)
+            arb_zero(res);
+        else
+            arb_set_round(res, initial, prec);
+        return;
+    }
+
+    /* find the range of exponents of the terms; fall back to the
+       naive algorithm if anything is special or has a huge exponent */
+    max_exp = WORD_MIN;
+    min_exp = WORD_MAX;
+
+    if (initial != NULL)
+    {
+        if (!ARB_IS_LAGOM(initial))
+        {
+            _arb_dot_naive(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
+
+        if (!arf_is_zero(arb_midref(initial)))
+        {
+            e = ARF_EXP(arb_midref(initial));
+            max_exp = e;
+            min_exp = e - ARF_SIZE(arb_midref(initial)) * FLINT_BITS;
+        }
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        xi = x + i * xstep;
+        yi = y + i * ystep;
+
+        if (!ARB_IS_LAGOM(xi) || !ARB_IS_LAGOM(yi))
+        {
+            _arb_dot_naive(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
+
+        if (!arf_is_zero(arb_midref(xi)) && !arf_is_zero(arb_midref(yi)))
+        {
+            e = ARF_EXP(arb_midref(xi)) + ARF_EXP(arb_midref(yi));
+            max_exp = FLINT_MAX(max_exp, e);
+            e -= (ARF_SIZE(arb_midref(xi)) + ARF_SIZE(arb_midref(yi))) * FLINT_BITS;
+            min_exp = FLINT_MIN(min_exp, e);
+        }
+    }
+
+    /* radius: sum of |xm| yr + |ym| xr + xr yr, plus the initial radius */
+    if (initial != NULL)
+        mag_fast_init_set(rad, arb_radref(initial));
+    else
+        mag_fast_zero(rad);
+
+    for (i = 0; i < len; i++)
+    {
+        xi = x + i * xstep;
+        yi = y + i * ystep;
+
+        if (!mag_fast_is_zero(arb_radref(xi)) || !mag_fast_is_zero(arb_radref(yi)))
+        {
+            mag_fast_init_set_arf(xm, arb_midref(xi));
+            mag_fast_init_set_arf(ym, arb_midref(yi));
+
+            mag_fast_addmul(rad, xm, arb_radref(yi));
+            mag_fast_addmul(rad, ym, arb_radref(xi));
+            mag_fast_addmul(rad, arb_radref(xi), arb_radref(yi));
+        }
+    }
+
+    if (max_exp == WORD_MIN)
+    {
+        arf_zero(arb_midref(res));
+        mag_set(arb_radref(res), rad);
+        return;
+    }
+
+    /* the sum of len + 1 terms each < 2^max_exp, and a sign bit, fits */
+    padding = FLINT_BIT_COUNT(len) + 2;
+    top = max_exp + padding;
+
+    /* use a window covering prec + 2 limbs of guard bits below the
+       largest term, or just enough to add all terms exactly */
+    if (prec >= max_exp - min_exp)
+        width = max_exp - min_exp + padding;
+    else
+        width = prec + 2 * FLINT_BITS + padding;
+
+    sn = (width + FLINT_BITS - 1) / FLINT_BITS;
+    bottom = top - sn * FLINT_BITS;
+
+    TMP_START;
+
+    sum = TMP_ALLOC_LIMBS(sn);
+    tmp = TMP_ALLOC_LIMBS(2 * sn + 1);
+    prod = TMP_ALLOC_LIMBS(2 * sn);
+
+    flint_mpn_zero(sum, sn);
+    err_count = 0;
+
+    if (initial != NULL && !arf_is_zero(arb_midref(initial)))
+    {
+        ARF_GET_MPN_READONLY(xptr, xn, arb_midref(initial));
+
+        if (xn > sn)
+        {
+            xptr += xn - sn;
+            xn = sn;
+            err_count++;
+        }
+
+        err_count += _arb_dot_add_term(sum, sn, bottom, tmp, xptr, xn,
+            ARF_EXP(arb_midref(initial)), ARF_SGNBIT(arb_midref(initial)));
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        xi = x + i * xstep;
+        yi = y + i * ystep;
+
+        if (arf_is_zero(arb_midref(xi)) || arf_is_zero(arb_midref(yi)))
+            continue;
+
+        e = ARF_EXP(arb_midref(xi)) + ARF_EXP(arb_midref(yi));
+        negative = ARF_SGNBIT(arb_midref(xi)) ^ ARF_SGNBIT(arb_midref(yi)) ^ subtract;
+
+        ARF_GET_MPN_READONLY(xptr, xn, arb_midref(xi));
+        ARF_GET_MPN_READONLY(yptr, yn, arb_midref(yi));
+
+        /* keeping the top sn limbs of each factor changes the product
+           by less than 2^(e - sn * FLINT_BITS) <= 2^bottom */
+        if (xn > sn)
+        {
+            xptr += xn - sn;
+            xn = sn;
+            err_count++;
+        }
+
+        if (yn > sn)
+        {
+            yptr += yn - sn;
+            yn = sn;
+            err_count++;
+        }
+
+        if (xn == 1 && yn == 1)
+        {
+            umul_ppmm(prod[1], prod[0], xptr[0], yptr[0]);
+        }
+        else if (xn >= yn)
+        {
+            mpn_mul(prod, xptr, xn, yptr, yn);
+        }
+        else
+        {
+            mpn_mul(prod, yptr, yn, xptr, xn);
+        }
+
+        err_count += _arb_dot_add_term(sum, sn, bottom, tmp, prod, xn + yn,
+            e, negative);
+    }
+
+    negative = (sum[sn - 1] >> (FLINT_BITS - 1)) != 0;
+
+    if (negative)
+        mpn_neg(sum, sum, sn);
+
+    n = sn;
+    while (n > 0 && sum[n - 1] == 0)
+        n--;
+
+    if (n == 0)
+    {
+        arf_zero(arb_midref(res));
+        inexact = 0;
+    }
+    else
+    {
+        inexact = _arf_set_round_mpn(arb_midref(res), &fix, sum, n,
+            negative, prec, ARB_RND);
+        _fmpz_demote(ARF_EXPREF(arb_midref(res)));
+        ARF_EXP(arb_midref(res)) = bottom + n * FLINT_BITS + fix;
+    }
+
+    if (err_count != 0)
+        mag_fast_add_2exp_si(rad, rad, bottom + FLINT_BIT_COUNT(err_count));
+
+    if (inexact)
+        arf_mag_fast_add_ulp(rad, rad, arb_midref(res), prec);
+
+    mag_set(arb_radref(res), rad);
+
+    TMP_END;
+}
+
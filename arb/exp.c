@@ -20,10 +20,12 @@
 /******************************************************************************
 
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "arb.h"
+#include "arb_dd.h"
 
 #define TMP_ALLOC_LIMBS(__n) TMP_ALLOC((__n) * sizeof(mp_limb_t))
 
@@ -97,6 +99,8 @@ arb_exp_arf_fallback(arb_t z, const arf_t x, slong mag, slong prec, int minus_on
 {
     if (mag > 64)
         arb_exp_arf_huge(z, x, mag, prec, minus_one);
+    else if (prec > ARB_EXP_TAB2_PREC)
+        arb_exp_arf_rtab(z, x, prec, minus_one);
     else
         arb_exp_arf_bb(z, x, prec, minus_one);
 }
@@ -190,6 +194,10 @@ arb_exp_arf(arb_t z, const arf_t x, slong prec, int minus_one)
             return;
         }
 
+        /* at low precision, use double-double arithmetic if possible */
+        if (!minus_one && prec <= ARB_DD_AUTO_PREC && arb_dd_exp_arf(z, x, prec))
+            return;
+
         /* Absolute working precision (NOT rounded to a limb multiple) */
         wp = prec + 8;
         if (minus_one && exp <= 0)
@@ -259,7 +267,7 @@ arb_exp_arf(arb_t z, const arf_t x, slong prec, int minus_one)
            error is <= 2^-wp */
         N = _arb_exp_taylor_bound(-r, wp);
 
-        if (N < 60)
+        if (N < arb_tune_get(ARB_TUNE_EXP_SINH_TERMS, wp))
         {
             /* Evaluate Taylor series */
             _arb_exp_taylor_rs(t, &error2, w, wn, N);
@@ -0,0 +1,126 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+void
+arb_exp_arf_rtab(arb_t z, const arf_t x, slong prec, int minus_one)
+{
+    const arb_rtab_struct * tab;
+    slong mag, wp, i, k, bits;
+    arb_t t, u;
+    arf_t r;
+    fmpz_t n, q;
+    mag_t err, m;
+
+    mag = arf_abs_bound_lt_2exp_si(x);
+    bits = ARB_RTAB_BITS * ARB_RTAB_EXP_LEVELS;
+
+    wp = prec + 10 + 2 * FLINT_BIT_COUNT(prec);
+    if (minus_one && mag < 0)
+        wp += (-mag);
+
+    /* the tables only help if they remove some leading bits */
+    if (mag > 64 || mag < -bits || (tab = _arb_rtab_get(wp, 0)) == NULL)
+    {
+        arb_exp_arf_bb(z, x, prec, minus_one);
+        return;
+    }
+
+    arb_init(t);
+    arb_init(u);
+    arf_init(r);
+    fmpz_init(n);
+    fmpz_init(q);
+    mag_init(err);
+    mag_init(m);
+
+    /* t = x - n log(2) with 0 <= t < log(2) (approximately) */
+    arb_set_arf(t, x);
+    arb_div(u, t, &tab->log2, FLINT_MAX(mag, 0) + 2 * FLINT_BITS);
+    arf_get_fmpz(n, arb_midref(u), ARF_RND_FLOOR);
+    arb_submul_fmpz(t, &tab->log2, n, wp);
+
+    /* write mid(t) = k / 2^15 + r with 0 <= k < 2^15, so that |r| is
+       tiny and exp(k / 2^15) is a product of one entry per level */
+    arf_mul_2exp_si(r, arb_midref(t), bits);
+    arf_get_fmpz(q, r, ARF_RND_FLOOR);
+
+    if (fmpz_sgn(q) < 0)
+        k = 0;
+    else if (fmpz_cmp_si(q, (WORD(1) << bits) - 1) > 0)
+        k = (WORD(1) << bits) - 1;
+    else
+        k = fmpz_get_si(q);
+
+    fmpz_set_si(q, k);
+    arf_sub_fmpz(r, r, q, ARF_PREC_EXACT, ARF_RND_DOWN);
+    arf_mul_2exp_si(r, r, -bits);
+
+    /* exp(r), where |exp(r) - 1| <= 2|r| if r is negligible */
+    if (arf_is_zero(r))
+    {
+        arb_one(u);
+    }
+    else if (arf_cmpabs_2exp_si(r, -wp) < 0)
+    {
+        arb_one(u);
+        mag_set_ui_2exp_si(arb_radref(u), 1, -wp + 1);
+    }
+    else
+    {
+        arb_exp_arf_bb(u, r, wp, 0);
+    }
+
+    /* exp(r + e) - exp(r) = exp(r) (exp(e) - 1) */
+    mag_expm1(err, arb_radref(t));
+    arb_get_mag(m, u);
+    mag_addmul(arb_radref(u), err, m);
+
+    for (i = ARB_RTAB_EXP_LEVELS - 1; i >= 0; i--)
+    {
+        slong p = k & (ARB_RTAB_NUM - 1);
+
+        if (p != 0)
+            arb_mul(u, u, tab->exp_tab + i * ARB_RTAB_NUM + p, wp);
+
+        k >>= ARB_RTAB_BITS;
+    }
+
+    arb_mul_2exp_fmpz(u, u, n);
+
+    if (minus_one)
+        arb_sub_ui(u, u, 1, wp);
+
+    arb_set_round(z, u, prec);
+
+    arb_clear(t);
+    arb_clear(u);
+    arf_clear(r);
+    fmpz_clear(n);
+    fmpz_clear(q);
+    mag_clear(err);
+    mag_clear(m);
+}
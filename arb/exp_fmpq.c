@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+#include "hypgeom.h"
+
+void
+arb_exp_fmpq(arb_t res, const fmpq_t x, slong prec)
+{
+    const fmpz * p = fmpq_numref(x);
+    const fmpz * q = fmpq_denref(x);
+    slong s, wp, pbits, qbits;
+
+    if (fmpq_is_zero(x))
+    {
+        arb_one(res);
+        return;
+    }
+
+    pbits = fmpz_bits(p);
+    qbits = fmpz_bits(q);
+
+    if (pbits + qbits > arb_tune_get(ARB_TUNE_FMPQ_BS_BITS, prec) ||
+        pbits > qbits + 8)
+    {
+        arb_t t;
+        arb_init(t);
+        wp = prec + FLINT_MAX(0, pbits - qbits) + 4;
+        arb_set_fmpq(t, x, wp);
+        arb_exp(res, t, prec);
+        arb_clear(t);
+    }
+    else
+    {
+        hypgeom_t series;
+        arb_t t;
+
+        /* exp(x) = exp(x/2^s)^(2^s) with |x/2^s| < 1/2 */
+        s = FLINT_MAX(0, pbits - qbits + 2);
+        wp = prec + 2 * s + FLINT_BIT_COUNT(prec) + 10;
+
+        arb_init(t);
+        hypgeom_init(series);
+
+        /* sum of (p/(q 2^s))^k / k! */
+        fmpz_poly_set_str(series->A, "1  1");
+        fmpz_poly_set_str(series->B, "1  1");
+        fmpz_poly_set_fmpz(series->P, p);
+        fmpz_poly_set_coeff_fmpz(series->Q, 1, q);
+        fmpz_poly_scalar_mul_2exp(series->Q, series->Q, s);
+
+        arb_hypgeom_infsum(res, t, series, wp, wp);
+        arb_div(res, res, t, wp);
+
+        for ( ; s > 0; s--)
+            arb_mul(res, res, res, wp);
+
+        arb_set_round(res, res, prec);
+
+        hypgeom_clear(series);
+        arb_clear(t);
+    }
+}
+
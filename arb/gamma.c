@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2013 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -27,6 +28,7 @@
 #include "acb.h"
 #include "bernoulli.h"
 #include "hypgeom.h"
+#include "arb_instr.h"
 
 /* tuning factor */
 #define GAMMA_STIRLING_BETA 0.27
@@ -804,7 +806,8 @@ _arb_gamma(arb_t y, const arb_t x, slong prec, int inverse)
                 fmpq_t a;
                 fmpq_init(a);
                 arf_get_fmpq(a, mid);
-                arb_gamma_fmpq(y, a, prec + 2 * inverse);
+                ARB_INSTR_TIME(ARB_INSTR_GAMMA_FMPQ, 0,
+                    arb_gamma_fmpq(y, a, prec + 2 * inverse));
                 if (inverse)
                     arb_inv(y, y, prec);
                 fmpq_clear(a);
@@ -826,11 +829,13 @@ _arb_gamma(arb_t y, const arb_t x, slong prec, int inverse)
         /* gamma(x) = (rf(1-x, r) * pi) / (gamma(1-x+r) sin(pi x)) */
         arb_sub_ui(t, x, 1, wp);
         arb_neg(t, t);
-        arb_rising_ui_rec(u, t, r, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_RISING, r,
+            arb_rising_ui_rec(u, t, r, wp));
         arb_const_pi(v, wp);
         arb_mul(u, u, v, wp);
         arb_add_ui(t, t, r, wp);
-        arb_gamma_stirling_eval(v, t, n, 0, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_STIRLING, n,
+            arb_gamma_stirling_eval(v, t, n, 0, wp));
         arb_exp(v, v, wp);
         arb_sin_pi(t, x, wp);
         arb_mul(v, v, t, wp);
@@ -839,9 +844,11 @@ _arb_gamma(arb_t y, const arb_t x, slong prec, int inverse)
     {
         /* gamma(x) = gamma(x+r) / rf(x,r) */
         arb_add_ui(t, x, r, wp);
-        arb_gamma_stirling_eval(u, t, n, 0, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_STIRLING, n,
+            arb_gamma_stirling_eval(u, t, n, 0, wp));
         arb_exp(u, u, prec);
-        arb_rising_ui_rec(v, x, r, wp);
+        ARB_INSTR_TIME(ARB_INSTR_GAMMA_RISING, r,
+            arb_rising_ui_rec(v, x, r, wp));
     }
 
     if (inverse)
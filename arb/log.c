@@ -20,10 +20,12 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "arb.h"
+#include "arb_dd.h"
 
 #define TMP_ALLOC_LIMBS(size) TMP_ALLOC((size) * sizeof(mp_limb_t))
 
@@ -214,6 +216,10 @@ arb_log_arf(arb_t z, const arf_t x, slong prec)
             return;
         }
 
+        /* at low precision, use double-double arithmetic if possible */
+        if (prec <= ARB_DD_AUTO_PREC && arb_dd_log_arf(z, x, prec))
+            return;
+
         /* Absolute working precision (NOT rounded to a limb multiple) */
         wp = prec + closeness_to_one + 5;
 
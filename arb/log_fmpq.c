@@ -0,0 +1,158 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+#include "hypgeom.h"
+
+void
+arb_log_fmpq(arb_t res, const fmpq_t x, slong prec)
+{
+    fmpz_t u, v, a, b;
+    slong e, wp;
+
+    if (fmpz_sgn(fmpq_numref(x)) <= 0)
+    {
+        arb_indeterminate(res);
+        return;
+    }
+
+    if (fmpq_is_one(x))
+    {
+        arb_zero(res);
+        return;
+    }
+
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(a);
+    fmpz_init(b);
+
+    /* x = 2^e u / v with u / v in [1/sqrt(2), sqrt(2)] */
+    e = fmpz_bits(fmpq_numref(x)) - fmpz_bits(fmpq_denref(x));
+
+    if (e >= 0)
+    {
+        fmpz_set(u, fmpq_numref(x));
+        fmpz_mul_2exp(v, fmpq_denref(x), e);
+    }
+    else
+    {
+        fmpz_mul_2exp(u, fmpq_numref(x), -e);
+        fmpz_set(v, fmpq_denref(x));
+    }
+
+    fmpz_mul(a, u, u);
+    fmpz_mul(b, v, v);
+    fmpz_mul_2exp(a, a, 1);
+
+    if (fmpz_cmp(a, b) < 0)
+    {
+        fmpz_mul_2exp(u, u, 1);
+        e--;
+    }
+    else
+    {
+        /* 4 u^2 > 8 v^2 iff u / v > sqrt(2) */
+        fmpz_mul_2exp(a, a, 1);
+        fmpz_mul_2exp(b, b, 3);
+
+        if (fmpz_cmp(a, b) > 0)
+        {
+            fmpz_mul_2exp(v, v, 1);
+            e++;
+        }
+    }
+
+    if (fmpz_bits(u) + fmpz_bits(v) > arb_tune_get(ARB_TUNE_FMPQ_BS_BITS, prec))
+    {
+        arb_t t;
+        arb_init(t);
+
+        /* extra precision for the cancellation in log(x) when x ~ 1 */
+        fmpz_sub(a, fmpq_numref(x), fmpq_denref(x));
+        wp = prec + 8 + FLINT_MAX(0,
+            (slong) fmpz_bits(fmpq_denref(x)) - (slong) fmpz_bits(a));
+
+        arb_set_fmpq(t, x, wp);
+        arb_log(res, t, prec);
+        arb_clear(t);
+    }
+    else
+    {
+        hypgeom_t series;
+        arb_t t, w;
+
+        wp = prec + FLINT_BIT_COUNT(prec) + FLINT_BIT_COUNT(FLINT_ABS(e)) + 10;
+
+        arb_init(t);
+        arb_init(w);
+
+        /* log(u/v) = 2 atanh(z), z = a/b = (u-v)/(u+v), |z| < 0.172 */
+        fmpz_sub(a, u, v);
+        fmpz_add(b, u, v);
+
+        if (fmpz_is_zero(a))
+        {
+            arb_zero(res);
+        }
+        else
+        {
+            /* atanh(z) = z sum of z^(2k) / (2k+1) */
+            hypgeom_init(series);
+            fmpz_poly_set_str(series->A, "1  1");
+            fmpz_poly_set_str(series->B, "2  1 2");
+            fmpz_mul(u, a, a);
+            fmpz_mul(v, b, b);
+            fmpz_poly_set_fmpz(series->P, u);
+            fmpz_poly_set_fmpz(series->Q, v);
+
+            arb_hypgeom_infsum(res, t, series, wp, wp);
+            arb_mul_fmpz(res, res, a, wp);
+            arb_mul_fmpz(t, t, b, wp);
+            arb_div(res, res, t, wp);
+            arb_mul_2exp_si(res, res, 1);
+
+            hypgeom_clear(series);
+        }
+
+        if (e != 0)
+        {
+            arb_const_log2(w, wp);
+            arb_mul_si(w, w, e, wp);
+            arb_add(res, res, w, wp);
+        }
+
+        arb_set_round(res, res, prec);
+
+        arb_clear(t);
+        arb_clear(w);
+    }
+
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(a);
+    fmpz_clear(b);
+}
+
@@ -0,0 +1,302 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "arb.h"
+
+/*
+    Tables for exp and atan at precisions above ARB_EXP_TAB2_PREC and
+    ARB_ATAN_TAB2_PREC are computed on first use and shared by all threads.
+    To avoid one table per distinct precision, the requested precision
+    is rounded up to a multiple of 2^(bits(prec) - 3), so that there are
+    at most eight table sizes per doubling of the precision. Tables are
+    never freed while in use; they are freed when the last thread that
+    has used them calls flint_cleanup().
+
+    The global mutex only protects the list of tables, and each entry
+    has a mutex protecting its flags. A table is computed without holding
+    either lock and only published under the entry mutex: computing it
+    (notably log(2)) may run tasks on the thread pool, and such a task
+    may look up the same table from the same thread. Threads racing to
+    build the same table may both compute it; the second copy is thrown
+    away. Each thread remembers the last few tables it has seen fully
+    built, so that these can be read without taking any lock.
+*/
+
+#define RTAB_GUARD_BITS 32
+#define RTAB_LOG2_GUARD_BITS 96
+#define RTAB_CACHE_SIZE 4
+
+typedef struct
+{
+    arb_rtab_struct tab;
+    pthread_mutex_t mutex;
+}
+arb_rtab_entry_struct;
+
+static pthread_mutex_t arb_rtab_mutex = PTHREAD_MUTEX_INITIALIZER;
+static arb_rtab_entry_struct ** arb_rtab = NULL;
+static slong arb_rtab_num = 0;
+static slong arb_rtab_alloc = 0;
+static slong arb_rtab_users = 0;
+static slong arb_rtab_max = ARB_RTAB_DEFAULT_MAX_PREC;
+
+FLINT_TLS_PREFIX int arb_rtab_have_registered_cleanup = 0;
+
+/* built tables seen by this thread, most recent first; index 0 for exp
+   and index 1 for atan */
+FLINT_TLS_PREFIX const arb_rtab_struct * arb_rtab_cache[2][RTAB_CACHE_SIZE];
+FLINT_TLS_PREFIX slong arb_rtab_cache_num[2] = { 0, 0 };
+
+static void
+_arb_rtab_cleanup(void)
+{
+    slong i, n;
+
+    pthread_mutex_lock(&arb_rtab_mutex);
+
+    arb_rtab_users--;
+
+    if (arb_rtab_users == 0)
+    {
+        for (i = 0; i < arb_rtab_num; i++)
+        {
+            arb_rtab_struct * tab = &arb_rtab[i]->tab;
+
+            n = ARB_RTAB_NUM;
+
+            if (tab->have_exp)
+                _arb_vec_clear(tab->exp_tab, ARB_RTAB_EXP_LEVELS * n);
+
+            if (tab->have_atan)
+                _arb_vec_clear(tab->atan_tab, ARB_RTAB_ATAN_LEVELS * n);
+
+            arb_clear(&tab->log2);
+            pthread_mutex_destroy(&arb_rtab[i]->mutex);
+            flint_free(arb_rtab[i]);
+        }
+
+        flint_free(arb_rtab);
+        arb_rtab = NULL;
+        arb_rtab_num = 0;
+        arb_rtab_alloc = 0;
+    }
+
+    pthread_mutex_unlock(&arb_rtab_mutex);
+
+    arb_rtab_cache_num[0] = 0;
+    arb_rtab_cache_num[1] = 0;
+    arb_rtab_have_registered_cleanup = 0;
+}
+
+void
+arb_rtab_set_max_prec(slong prec)
+{
+    arb_rtab_max = FLINT_MAX(prec, 0);
+}
+
+slong
+arb_rtab_max_prec(void)
+{
+    return arb_rtab_max;
+}
+
+/* exp(j 2^(-5(i+1))) for j < 32 at level i, computed by repeated
+   multiplication with a single exponential per level */
+static arb_ptr
+_arb_rtab_build_exp(arb_t log2, slong prec)
+{
+    slong i, j, wp;
+    arb_ptr T;
+    arb_t b;
+    arf_t t;
+
+    wp = prec + RTAB_GUARD_BITS;
+    T = _arb_vec_init(ARB_RTAB_EXP_LEVELS * ARB_RTAB_NUM);
+    arb_init(b);
+    arf_init(t);
+
+    for (i = 0; i < ARB_RTAB_EXP_LEVELS; i++)
+    {
+        arf_set_si_2exp_si(t, 1, -ARB_RTAB_BITS * (i + 1));
+        arb_exp_arf_bb(b, t, wp, 0);
+
+        arb_one(T + i * ARB_RTAB_NUM);
+        arb_set(T + i * ARB_RTAB_NUM + 1, b);
+
+        for (j = 2; j < ARB_RTAB_NUM; j++)
+            arb_mul(T + i * ARB_RTAB_NUM + j, T + i * ARB_RTAB_NUM + j - 1, b, wp);
+    }
+
+    arb_const_log2(log2, prec + RTAB_LOG2_GUARD_BITS);
+
+    arb_clear(b);
+    arf_clear(t);
+
+    return T;
+}
+
+/* atan(j 2^(-5(i+1))) for j < 32 at level i */
+static arb_ptr
+_arb_rtab_build_atan(slong prec)
+{
+    slong i, j, wp;
+    arb_ptr T;
+    arf_t t;
+
+    wp = prec + RTAB_GUARD_BITS;
+    T = _arb_vec_init(ARB_RTAB_ATAN_LEVELS * ARB_RTAB_NUM);
+    arf_init(t);
+
+    for (i = 0; i < ARB_RTAB_ATAN_LEVELS; i++)
+    {
+        for (j = 1; j < ARB_RTAB_NUM; j++)
+        {
+            arf_set_si_2exp_si(t, j, -ARB_RTAB_BITS * (i + 1));
+            arb_atan_arf_bb(T + i * ARB_RTAB_NUM + j, t, wp);
+        }
+    }
+
+    arf_clear(t);
+
+    return T;
+}
+
+const arb_rtab_struct *
+_arb_rtab_get(slong prec, int atan)
+{
+    arb_rtab_entry_struct * entry;
+    const arb_rtab_struct ** cache;
+    slong i, step;
+    int built;
+
+    step = WORD(1) << FLINT_MAX(0, FLINT_BIT_COUNT(prec) - 3);
+    prec = ((prec + step - 1) / step) * step;
+
+    if (prec > arb_rtab_max)
+        return NULL;
+
+    atan = (atan != 0);
+    cache = arb_rtab_cache[atan];
+
+    for (i = 0; i < arb_rtab_cache_num[atan]; i++)
+        if (cache[i]->prec == prec)
+            return cache[i];
+
+    /* find or insert the entry */
+    pthread_mutex_lock(&arb_rtab_mutex);
+
+    entry = NULL;
+    for (i = 0; i < arb_rtab_num; i++)
+    {
+        if (arb_rtab[i]->tab.prec == prec)
+        {
+            entry = arb_rtab[i];
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        if (arb_rtab_num == arb_rtab_alloc)
+        {
+            arb_rtab_alloc = FLINT_MAX(4, 2 * arb_rtab_alloc);
+            arb_rtab = flint_realloc(arb_rtab,
+                arb_rtab_alloc * sizeof(arb_rtab_entry_struct *));
+        }
+
+        entry = flint_malloc(sizeof(arb_rtab_entry_struct));
+        entry->tab.prec = prec;
+        entry->tab.have_exp = 0;
+        entry->tab.have_atan = 0;
+        entry->tab.exp_tab = NULL;
+        entry->tab.atan_tab = NULL;
+        arb_init(&entry->tab.log2);
+        pthread_mutex_init(&entry->mutex, NULL);
+
+        arb_rtab[arb_rtab_num++] = entry;
+    }
+
+    if (!arb_rtab_have_registered_cleanup)
+    {
+        arb_rtab_users++;
+        arb_rtab_have_registered_cleanup = 1;
+        flint_register_cleanup_function(_arb_rtab_cleanup);
+    }
+
+    pthread_mutex_unlock(&arb_rtab_mutex);
+
+    pthread_mutex_lock(&entry->mutex);
+    built = atan ? entry->tab.have_atan : entry->tab.have_exp;
+    pthread_mutex_unlock(&entry->mutex);
+
+    if (!built)
+    {
+        arb_ptr T;
+        arb_t log2;
+
+        arb_init(log2);
+
+        if (atan)
+            T = _arb_rtab_build_atan(prec);
+        else
+            T = _arb_rtab_build_exp(log2, prec);
+
+        pthread_mutex_lock(&entry->mutex);
+
+        if (atan && !entry->tab.have_atan)
+        {
+            entry->tab.atan_tab = T;
+            entry->tab.have_atan = 1;
+            T = NULL;
+        }
+        else if (!atan && !entry->tab.have_exp)
+        {
+            entry->tab.exp_tab = T;
+            arb_swap(&entry->tab.log2, log2);
+            entry->tab.have_exp = 1;
+            T = NULL;
+        }
+
+        pthread_mutex_unlock(&entry->mutex);
+
+        /* another thread published the table first */
+        if (T != NULL)
+            _arb_vec_clear(T, (atan ? ARB_RTAB_ATAN_LEVELS
+                : ARB_RTAB_EXP_LEVELS) * ARB_RTAB_NUM);
+
+        arb_clear(log2);
+    }
+
+    /* the table is complete and, having taken its mutex, this thread
+       sees all of it; later lookups can skip the locks */
+    for (i = FLINT_MIN(arb_rtab_cache_num[atan], RTAB_CACHE_SIZE - 1); i > 0; i--)
+        cache[i] = cache[i - 1];
+    cache[0] = &entry->tab;
+    arb_rtab_cache_num[atan] = FLINT_MIN(arb_rtab_cache_num[atan] + 1,
+        RTAB_CACHE_SIZE);
+
+    return &entry->tab;
+}
@@ -0,0 +1,183 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+/*
+    The scratch space of each thread is a list of chunks of initialised
+    arb_structs which are never cleared between uses, so that the limbs
+    of the entries are reused. Vectors are handed out from the current
+    chunk like from a stack; a vector that does not fit in what remains
+    of the current chunk is taken from the start of the next one.
+    Chunks are not moved in memory, so vectors remain valid until the
+    scope in which they were obtained is ended.
+*/
+
+#define ARB_SCRATCH_MIN_CHUNK 256
+
+typedef struct
+{
+    arb_ptr entries;
+    slong alloc;
+}
+arb_scratch_chunk_struct;
+
+typedef struct
+{
+    slong chunk;
+    slong used;
+}
+arb_scratch_mark_struct;
+
+static FLINT_TLS_PREFIX arb_scratch_chunk_struct * arb_scratch_chunks = NULL;
+static FLINT_TLS_PREFIX slong arb_scratch_num_chunks = 0;
+static FLINT_TLS_PREFIX slong arb_scratch_alloc_chunks = 0;
+
+static FLINT_TLS_PREFIX arb_scratch_mark_struct * arb_scratch_marks = NULL;
+static FLINT_TLS_PREFIX slong arb_scratch_num_marks = 0;
+static FLINT_TLS_PREFIX slong arb_scratch_alloc_marks = 0;
+
+/* current position: entries [0, used) of the current chunk are in use */
+static FLINT_TLS_PREFIX slong arb_scratch_chunk = -1;
+static FLINT_TLS_PREFIX slong arb_scratch_used = 0;
+
+static FLINT_TLS_PREFIX int arb_scratch_have_registered_cleanup = 0;
+
+void
+arb_scratch_cleanup(void)
+{
+    slong i;
+
+    if (arb_scratch_num_marks != 0)
+    {
+        flint_printf("arb_scratch_cleanup: scratch space still in use\n");
+        abort();
+    }
+
+    for (i = 0; i < arb_scratch_num_chunks; i++)
+        _arb_vec_clear(arb_scratch_chunks[i].entries,
+            arb_scratch_chunks[i].alloc);
+
+    flint_free(arb_scratch_chunks);
+    flint_free(arb_scratch_marks);
+
+    arb_scratch_chunks = NULL;
+    arb_scratch_num_chunks = 0;
+    arb_scratch_alloc_chunks = 0;
+    arb_scratch_marks = NULL;
+    arb_scratch_alloc_marks = 0;
+    arb_scratch_chunk = -1;
+    arb_scratch_used = 0;
+    arb_scratch_have_registered_cleanup = 0;
+}
+
+void
+arb_scratch_begin(void)
+{
+    if (arb_scratch_num_marks == arb_scratch_alloc_marks)
+    {
+        arb_scratch_alloc_marks = FLINT_MAX(16, 2 * arb_scratch_alloc_marks);
+        arb_scratch_marks = flint_realloc(arb_scratch_marks,
+            sizeof(arb_scratch_mark_struct) * arb_scratch_alloc_marks);
+    }
+
+    arb_scratch_marks[arb_scratch_num_marks].chunk = arb_scratch_chunk;
+    arb_scratch_marks[arb_scratch_num_marks].used = arb_scratch_used;
+    arb_scratch_num_marks++;
+}
+
+void
+arb_scratch_end(void)
+{
+    if (arb_scratch_num_marks == 0)
+    {
+        flint_printf("arb_scratch_end: no matching arb_scratch_begin\n");
+        abort();
+    }
+
+    arb_scratch_num_marks--;
+    arb_scratch_chunk = arb_scratch_marks[arb_scratch_num_marks].chunk;
+    arb_scratch_used = arb_scratch_marks[arb_scratch_num_marks].used;
+}
+
+arb_ptr
+arb_scratch_vec(slong n)
+{
+    arb_scratch_chunk_struct * c;
+    arb_ptr v;
+
+    if (arb_scratch_num_marks == 0)
+    {
+        flint_printf("arb_scratch_vec: called outside arb_scratch_begin/end\n");
+        abort();
+    }
+
+    if (arb_scratch_chunk >= 0 &&
+        arb_scratch_chunks[arb_scratch_chunk].alloc - arb_scratch_used >= n)
+    {
+        v = arb_scratch_chunks[arb_scratch_chunk].entries + arb_scratch_used;
+        arb_scratch_used += n;
+        return v;
+    }
+
+    arb_scratch_chunk++;
+
+    if (arb_scratch_chunk == arb_scratch_num_chunks)
+    {
+        if (arb_scratch_num_chunks == arb_scratch_alloc_chunks)
+        {
+            arb_scratch_alloc_chunks = FLINT_MAX(4, 2 * arb_scratch_alloc_chunks);
+            arb_scratch_chunks = flint_realloc(arb_scratch_chunks,
+                sizeof(arb_scratch_chunk_struct) * arb_scratch_alloc_chunks);
+        }
+
+        if (!arb_scratch_have_registered_cleanup)
+        {
+            flint_register_cleanup_function(arb_scratch_cleanup);
+            arb_scratch_have_registered_cleanup = 1;
+        }
+
+        c = arb_scratch_chunks + arb_scratch_num_chunks;
+        c->alloc = FLINT_MAX(n, ARB_SCRATCH_MIN_CHUNK);
+        c->entries = _arb_vec_init(c->alloc);
+        arb_scratch_num_chunks++;
+    }
+    else
+    {
+        /* this chunk is unused, so it can be replaced by a larger one */
+        c = arb_scratch_chunks + arb_scratch_chunk;
+
+        if (c->alloc < n)
+        {
+            _arb_vec_clear(c->entries, c->alloc);
+            c->alloc = FLINT_MAX(n, 2 * c->alloc);
+            c->entries = _arb_vec_init(c->alloc);
+        }
+    }
+
+    arb_scratch_used = n;
+    return c->entries;
+}
+
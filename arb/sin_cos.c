@@ -20,10 +20,12 @@
 /******************************************************************************
 
     Copyright (C) 2012-2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "arb.h"
+#include "arb_dd.h"
 #include "mpn_extras.h"
 
 #define TMP_ALLOC_LIMBS(__n) TMP_ALLOC((__n) * sizeof(mp_limb_t))
@@ -191,6 +193,10 @@ arb_sin_cos_arf_new(arb_t zsin, arb_t zcos, const arf_t x, slong prec)
     int sinnegative, cosnegative, swapsincos;
     TMP_INIT;
 
+    /* at low precision, use double-double arithmetic if possible */
+    if (prec <= ARB_DD_AUTO_PREC && arb_dd_sin_cos_arf(zsin, zcos, x, prec))
+        return;
+
     want_sin = (zsin != NULL);
     want_cos = (zcos != NULL);
 
@@ -300,7 +306,7 @@ arb_sin_cos_arf_new(arb_t zsin, arb_t zcos, const arf_t x, slong prec)
     /* the summation for sin/cos is actually done to (2N-1)! */
     N = (N + 1) / 2;
 
-    if (N < 14)
+    if (N < arb_tune_get(ARB_TUNE_SIN_COS_SQRT_TERMS, wp))
     {
         /* Evaluate Taylor series */
         _arb_sin_cos_taylor_rs(sina, cosa, &error2, w, wn, N, 0, 1);
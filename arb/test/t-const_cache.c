@@ -0,0 +1,170 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "arb.h"
+
+#define NUM_THREADS 4
+#define MAX_PREC 4000
+
+typedef struct
+{
+    slong seed;
+    arb_srcptr ref;
+    int fail;
+}
+work_t;
+
+static void *
+worker(void * arg_ptr)
+{
+    work_t * arg = (work_t *) arg_ptr;
+    flint_rand_t state;
+    slong i, which, prec;
+    arb_t x;
+
+    flint_randinit(state);
+    state->__randval = arg->seed;
+    state->__randval2 = arg->seed ^ UWORD(0x5555);
+    arb_init(x);
+
+    for (i = 0; i < 30 && !arg->fail; i++)
+    {
+        which = n_randint(state, 3);
+        prec = 2 + n_randint(state, MAX_PREC);
+
+        if (which == 0)
+            arb_const_pi(x, prec);
+        else if (which == 1)
+            arb_const_log2(x, prec);
+        else
+            arb_const_e(x, prec);
+
+        if (!arb_overlaps(x, arg->ref + which) || arb_rel_accuracy_bits(x) < prec - 2)
+            arg->fail = 1;
+    }
+
+    arb_clear(x);
+    flint_randclear(state);
+    flint_cleanup();
+    return NULL;
+}
+
+/* asks for itself at a higher precision while being computed, like a
+   pool task run by the computing thread while it waits */
+static void reentrant_const(arb_t x, slong prec);
+
+static void
+reentrant_eval(arb_t x, slong prec)
+{
+    if (prec < 1000)
+    {
+        arb_t y;
+        arb_init(y);
+        reentrant_const(y, 2 * prec);
+        arb_clear(y);
+    }
+
+    arb_const_pi(x, prec);
+}
+
+ARB_DEF_CACHED_CONSTANT(reentrant_const, reentrant_eval)
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+    arb_ptr ref;
+    mpfr_t t;
+
+    flint_printf("const_cache....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* reference values from MPFR, so that the cache starts out empty */
+    ref = _arb_vec_init(3);
+    mpfr_init2(t, MAX_PREC + 100);
+    mpfr_const_pi(t, MPFR_RNDN);
+    arf_set_mpfr(arb_midref(ref + 0), t);
+    mpfr_const_log2(t, MPFR_RNDN);
+    arf_set_mpfr(arb_midref(ref + 1), t);
+    mpfr_set_ui(t, 1, MPFR_RNDN);
+    mpfr_exp(t, t, MPFR_RNDN);
+    arf_set_mpfr(arb_midref(ref + 2), t);
+    mpfr_clear(t);
+
+    mag_set_ui_2exp_si(arb_radref(ref + 0), 1, -MAX_PREC - 90);
+    mag_set_ui_2exp_si(arb_radref(ref + 1), 1, -MAX_PREC - 90);
+    mag_set_ui_2exp_si(arb_radref(ref + 2), 1, -MAX_PREC - 90);
+
+    for (iter = 0; iter < 20; iter++)
+    {
+        pthread_t threads[NUM_THREADS];
+        work_t args[NUM_THREADS];
+        slong i;
+
+        for (i = 0; i < NUM_THREADS; i++)
+        {
+            args[i].seed = n_randlimb(state);
+            args[i].ref = ref;
+            args[i].fail = 0;
+            pthread_create(threads + i, NULL, worker, args + i);
+        }
+
+        for (i = 0; i < NUM_THREADS; i++)
+            pthread_join(threads[i], NULL);
+
+        for (i = 0; i < NUM_THREADS; i++)
+        {
+            if (args[i].fail)
+            {
+                flint_printf("FAIL: thread %wd, iter %wd\n\n", i, iter);
+                abort();
+            }
+        }
+    }
+
+    {
+        arb_t x;
+        arb_init(x);
+
+        reentrant_const(x, 100);
+
+        if (!arb_overlaps(x, ref + 0) || arb_rel_accuracy_bits(x) < 98)
+        {
+            flint_printf("FAIL: reentrant\n\n");
+            abort();
+        }
+
+        arb_clear(x);
+    }
+
+    _arb_vec_clear(ref, 3);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
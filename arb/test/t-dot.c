@@ -0,0 +1,178 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dot....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        arb_ptr x, y;
+        arb_t s, t, u, v;
+        slong i, len, prec, xstep, ystep, ebits;
+        int initial, subtract, revx, revy, special;
+
+        len = n_randint(state, 5);
+        if (n_randint(state, 4) == 0)
+            len += n_randint(state, 50);
+
+        prec = 2 + n_randint(state, 300);
+        ebits = 1 + n_randint(state, 12);
+        initial = n_randint(state, 2);
+        subtract = n_randint(state, 2);
+        revx = (len > 0) && n_randint(state, 2);
+        revy = (len > 0) && n_randint(state, 2);
+        special = (n_randint(state, 10) == 0);
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        arb_init(s);
+        arb_init(t);
+        arb_init(u);
+        arb_init(v);
+
+        for (i = 0; i < len; i++)
+        {
+            if (special)
+            {
+                arb_randtest_special(x + i, state, 1 + n_randint(state, 400), ebits);
+                arb_randtest_special(y + i, state, 1 + n_randint(state, 400), ebits);
+            }
+            else
+            {
+                arb_randtest(x + i, state, 1 + n_randint(state, 400), ebits);
+                arb_randtest(y + i, state, 1 + n_randint(state, 400), ebits);
+            }
+        }
+
+        if (special)
+            arb_randtest_special(s, state, 1 + n_randint(state, 400), ebits);
+        else
+            arb_randtest(s, state, 1 + n_randint(state, 400), ebits);
+
+        xstep = revx ? -1 : 1;
+        ystep = revy ? -1 : 1;
+
+        arb_dot(t, initial ? s : NULL, subtract,
+            revx ? x + len - 1 : x, xstep,
+            revy ? y + len - 1 : y, ystep, len, prec);
+
+        /* compare with repeated multiply-add */
+        if (initial)
+            arb_set(u, s);
+        else
+            arb_zero(u);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_srcptr xi = revx ? x + len - 1 - i : x + i;
+            arb_srcptr yi = revy ? y + len - 1 - i : y + i;
+
+            if (subtract)
+                arb_submul(u, xi, yi, ARF_PREC_EXACT);
+            else
+                arb_addmul(u, xi, yi, ARF_PREC_EXACT);
+        }
+
+        if (arb_is_finite(u) && !arb_overlaps(t, u))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("iter = %wd, len = %wd, prec = %wd\n\n", iter, len, prec);
+            flint_printf("initial = %d, subtract = %d\n\n", initial, subtract);
+            flint_printf("t = "); arb_printn(t, 50, ARB_STR_MORE); flint_printf("\n\n");
+            flint_printf("u = "); arb_printn(u, 50, ARB_STR_MORE); flint_printf("\n\n");
+            abort();
+        }
+
+        /* the exact dot product of the midpoints must be contained */
+        if (arb_is_finite(u))
+        {
+            if (initial)
+                arb_set_arf(u, arb_midref(s));
+            else
+                arb_zero(u);
+
+            for (i = 0; i < len; i++)
+            {
+                arb_srcptr xi = revx ? x + len - 1 - i : x + i;
+                arb_srcptr yi = revy ? y + len - 1 - i : y + i;
+
+                arb_set_arf(v, arb_midref(xi));
+                arb_mul_arf(v, v, arb_midref(yi), ARF_PREC_EXACT);
+
+                if (subtract)
+                    arb_sub(u, u, v, ARF_PREC_EXACT);
+                else
+                    arb_add(u, u, v, ARF_PREC_EXACT);
+            }
+
+            if (!arb_contains(t, u))
+            {
+                flint_printf("FAIL: containment\n\n");
+                flint_printf("iter = %wd, len = %wd, prec = %wd\n\n", iter, len, prec);
+                flint_printf("t = "); arb_printn(t, 50, ARB_STR_MORE); flint_printf("\n\n");
+                flint_printf("u = "); arb_printn(u, 50, ARB_STR_MORE); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* test aliasing of the output with the initial value */
+        if (initial)
+        {
+            arb_dot(s, s, subtract,
+                revx ? x + len - 1 : x, xstep,
+                revy ? y + len - 1 : y, ystep, len, prec);
+
+            if (!arb_equal(s, t))
+            {
+                flint_printf("FAIL: aliasing\n\n");
+                flint_printf("s = "); arb_printn(s, 50, ARB_STR_MORE); flint_printf("\n\n");
+                flint_printf("t = "); arb_printn(t, 50, ARB_STR_MORE); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        arb_clear(s);
+        arb_clear(t);
+        arb_clear(u);
+        arb_clear(v);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
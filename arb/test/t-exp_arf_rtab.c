@@ -0,0 +1,141 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+void
+arb_exp_arf_via_mpfr(arb_t z, const arf_t x, slong prec)
+{
+    mpfr_t t, u;
+    int exact;
+
+    mpfr_init2(t, 2 + arf_bits(x));
+    mpfr_init2(u, prec);
+
+    mpfr_set_emin(MPFR_EMIN_MIN);
+    mpfr_set_emax(MPFR_EMAX_MAX);
+
+    arf_get_mpfr(t, x, MPFR_RNDD);
+    exact = (mpfr_exp(u, t, MPFR_RNDD) == 0);
+
+    arf_set_mpfr(arb_midref(z), u);
+    if (!exact)
+        arf_mag_set_ulp(arb_radref(z), arb_midref(z), prec);
+
+    mpfr_clear(t);
+    mpfr_clear(u);
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("exp_arf_rtab....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 500; iter++)
+    {
+        arb_t x, y, z;
+        slong prec;
+        int minus_one;
+
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+
+        prec = ARB_EXP_TAB2_PREC + n_randint(state, 8000);
+        minus_one = n_randint(state, 2);
+
+        arb_randtest(x, state, 1 + n_randint(state, prec), 3);
+        mag_zero(arb_radref(x));
+
+        if (n_randint(state, 2))
+            arb_mul_2exp_si(x, x, 1 + n_randint(state, 40));
+        else
+            arb_mul_2exp_si(x, x, -n_randint(state, 24));
+
+        arb_exp_arf_via_mpfr(y, arb_midref(x), prec + 200);
+        if (minus_one)
+            arb_sub_ui(y, y, 1, prec + 200);
+
+        arb_exp_arf_rtab(z, arb_midref(x), prec, minus_one);
+
+        if (!arb_contains(z, y))
+        {
+            flint_printf("FAIL: containment\n\n");
+            flint_printf("prec = %wd, minus_one = %d\n\n", prec, minus_one);
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        if (arb_rel_accuracy_bits(z) < prec - 2)
+        {
+            flint_printf("FAIL: poor accuracy\n\n");
+            flint_printf("prec = %wd,  acc = %wd\n\n", prec, arb_rel_accuracy_bits(z));
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        /* with the tables disabled */
+        if (iter % 10 == 0)
+        {
+            arb_rtab_set_max_prec(0);
+            arb_exp_arf_rtab(y, arb_midref(x), prec, minus_one);
+            arb_rtab_set_max_prec(ARB_RTAB_DEFAULT_MAX_PREC);
+
+            if (!arb_overlaps(y, z))
+            {
+                flint_printf("FAIL: overlap without tables\n\n");
+                flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z, 50); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        arb_exp_arf_rtab(x, arb_midref(x), prec, minus_one);
+
+        if (!arb_overlaps(x, z))
+        {
+            flint_printf("FAIL: aliasing\n\n");
+            abort();
+        }
+
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("exp_fmpq....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        arb_t r1, r2;
+        fmpq_t x;
+        slong prec, acc;
+
+        prec = 2 + n_randint(state, 3000);
+
+        arb_init(r1);
+        arb_init(r2);
+        fmpq_init(x);
+
+        fmpq_randtest(x, state, 1 + n_randint(state, 40));
+
+        /* exercise both the direct and the generic algorithm */
+        arb_tune_set(ARB_TUNE_FMPQ_BS_BITS, prec,
+            n_randint(state, 2) ? 0 : n_randint(state, 400));
+
+        arb_exp_fmpq(r1, x, prec);
+
+        arb_set_fmpq(r2, x, prec + 100);
+        arb_exp(r2, r2, prec + 20);
+
+        if (!arb_overlaps(r1, r2))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("x = "); fmpq_print(x); flint_printf("\n\n");
+            flint_printf("r1 = "); arb_printd(r1, 15); flint_printf("\n\n");
+            flint_printf("r2 = "); arb_printd(r2, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        acc = arb_rel_accuracy_bits(r1);
+
+        if (acc < prec - 4)
+        {
+            flint_printf("FAIL: accuracy\n\n");
+            flint_printf("prec = %wd, acc = %wd\n\n", prec, acc);
+            flint_printf("x = "); fmpq_print(x); flint_printf("\n\n");
+            flint_printf("r1 = "); arb_printd(r1, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_clear(r1);
+        arb_clear(r2);
+        fmpq_clear(x);
+    }
+
+    arb_tune_reset();
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+#define MAX_DEPTH 8
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("scratch....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        arb_ptr v[MAX_DEPTH], w[MAX_DEPTH];
+        slong len[MAX_DEPTH];
+        slong i, j, depth;
+        arb_ptr p, q;
+
+        depth = 1 + n_randint(state, MAX_DEPTH);
+
+        /* nested scopes, each holding a vector with known values */
+        for (i = 0; i < depth; i++)
+        {
+            arb_scratch_begin();
+
+            len[i] = n_randint(state, 2) ? n_randint(state, 10) : n_randint(state, 1000);
+            v[i] = arb_scratch_vec(len[i]);
+            w[i] = _arb_vec_init(len[i]);
+
+            for (j = 0; j < len[i]; j++)
+            {
+                arb_randtest(w[i] + j, state, 1 + n_randint(state, 1000), 10);
+                arb_set(v[i] + j, w[i] + j);
+            }
+        }
+
+        for (i = depth - 1; i >= 0; i--)
+        {
+            for (j = 0; j < len[i]; j++)
+            {
+                if (!arb_equal(v[i] + j, w[i] + j))
+                {
+                    flint_printf("FAIL (values)\n\n");
+                    flint_printf("iter = %wd, depth = %wd, i = %wd, j = %wd\n",
+                        iter, depth, i, j);
+                    abort();
+                }
+            }
+
+            _arb_vec_clear(w[i], len[i]);
+            arb_scratch_end();
+        }
+
+        /* the same space is handed out again after a scope ends */
+        arb_scratch_begin();
+        i = 1 + n_randint(state, 100);
+        p = arb_scratch_vec(i);
+        arb_scratch_end();
+
+        arb_scratch_begin();
+        q = arb_scratch_vec(i);
+        arb_scratch_end();
+
+        if (p != q)
+        {
+            flint_printf("FAIL (reuse)\n\n");
+            abort();
+        }
+
+        if (n_randint(state, 100) == 0)
+            arb_scratch_cleanup();
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
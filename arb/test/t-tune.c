@@ -0,0 +1,163 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <stdio.h>
+#include "arb.h"
+
+#define FILENAME "arb_tune_test.txt"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("tune....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* save and load a random table */
+    for (iter = 0; iter < 100; iter++)
+    {
+        slong tab[ARB_TUNE_NUM][ARB_TUNE_TIERS];
+        slong dflt[ARB_TUNE_NUM][ARB_TUNE_TIERS];
+        int i, j;
+
+        arb_tune_reset();
+
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+            for (j = 0; j < ARB_TUNE_TIERS; j++)
+                dflt[i][j] = arb_tune_tab[i][j];
+
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+        {
+            for (j = 0; j < ARB_TUNE_TIERS; j++)
+            {
+                tab[i][j] = n_randint(state, 1000000);
+                arb_tune_set(i, (WORD(64) << (2 * j)), tab[i][j]);
+            }
+        }
+
+        if (!arb_tune_save(FILENAME))
+        {
+            flint_printf("FAIL (save)\n\n");
+            abort();
+        }
+
+        arb_tune_reset();
+
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+        {
+            for (j = 0; j < ARB_TUNE_TIERS; j++)
+            {
+                if (arb_tune_get(i, (WORD(64) << (2 * j))) != dflt[i][j])
+                {
+                    flint_printf("FAIL (reset)\n\n");
+                    flint_printf("i = %d, j = %d\n\n", i, j);
+                    abort();
+                }
+            }
+        }
+
+        if (!arb_tune_load(FILENAME))
+        {
+            flint_printf("FAIL (load)\n\n");
+            abort();
+        }
+
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+        {
+            for (j = 0; j < ARB_TUNE_TIERS; j++)
+            {
+                if (arb_tune_get(i, (WORD(64) << (2 * j))) != tab[i][j])
+                {
+                    flint_printf("FAIL (roundtrip)\n\n");
+                    flint_printf("i = %d, j = %d, %wd, %wd\n\n", i, j,
+                        arb_tune_get(i, (WORD(64) << (2 * j))), tab[i][j]);
+                    abort();
+                }
+            }
+        }
+    }
+
+    remove(FILENAME);
+
+    /* results are correct whatever the thresholds are */
+    for (iter = 0; iter < 1000; iter++)
+    {
+        arb_t x, y1, y2, s1, s2;
+        slong prec;
+        int j;
+
+        arb_init(x);
+        arb_init(y1);
+        arb_init(y2);
+        arb_init(s1);
+        arb_init(s2);
+
+        prec = 2 + n_randint(state, 4000);
+        arb_randtest(x, state, 1 + n_randint(state, 4000), 3);
+
+        for (j = 0; j < ARB_TUNE_TIERS; j++)
+        {
+            arb_tune_set(ARB_TUNE_EXP_SINH_TERMS, (WORD(64) << (2 * j)), 0);
+            arb_tune_set(ARB_TUNE_SIN_COS_SQRT_TERMS, (WORD(64) << (2 * j)), 0);
+        }
+        arb_exp(y1, x, prec);
+        arb_sin(s1, x, prec);
+
+        for (j = 0; j < ARB_TUNE_TIERS; j++)
+        {
+            arb_tune_set(ARB_TUNE_EXP_SINH_TERMS, (WORD(64) << (2 * j)), WORD_MAX);
+            arb_tune_set(ARB_TUNE_SIN_COS_SQRT_TERMS, (WORD(64) << (2 * j)), WORD_MAX);
+        }
+        arb_exp(y2, x, prec);
+        arb_sin(s2, x, prec);
+
+        if (!arb_overlaps(y1, y2) || !arb_overlaps(s1, s2))
+        {
+            flint_printf("FAIL (overlap)\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y1 = "); arb_printd(y1, 50); flint_printf("\n\n");
+            flint_printf("y2 = "); arb_printd(y2, 50); flint_printf("\n\n");
+            flint_printf("s1 = "); arb_printd(s1, 50); flint_printf("\n\n");
+            flint_printf("s2 = "); arb_printd(s2, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_tune_reset();
+
+        arb_clear(x);
+        arb_clear(y1);
+        arb_clear(y2);
+        arb_clear(s1);
+        arb_clear(s2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_log....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        arb_ptr x, y, z;
+        slong i, len, prec;
+        int aliasing;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 300);
+        prec = 2 + n_randint(state, 300);
+        aliasing = n_randint(state, 2);
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        z = _arb_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_randtest(x + i, state, 1 + n_randint(state, 300), 4);
+
+            /* mostly positive arguments */
+            if (n_randint(state, 4) != 0)
+                arb_abs(x + i, x + i);
+
+            arb_log(z + i, x + i, prec);
+        }
+
+        if (aliasing)
+        {
+            _arb_vec_set(y, x, len);
+            _arb_vec_log(y, y, len, prec);
+        }
+        else
+        {
+            _arb_vec_log(y, x, len, prec);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_equal(y + i, z + i))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("len = %wd, prec = %wd, i = %wd\n\n", len, prec, i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        _arb_vec_clear(z, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
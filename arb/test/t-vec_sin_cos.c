@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_sin_cos....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        arb_ptr x, s, c, s2, c2;
+        slong i, len, prec;
+        int which;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        len = n_randint(state, 300);
+        prec = 2 + n_randint(state, 300);
+        which = n_randint(state, 3);
+
+        x = _arb_vec_init(len);
+        s = _arb_vec_init(len);
+        c = _arb_vec_init(len);
+        s2 = _arb_vec_init(len);
+        c2 = _arb_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_randtest(x + i, state, 1 + n_randint(state, 300), 4);
+
+            if (which == 0)
+                arb_sin_cos(s + i, c + i, x + i, prec);
+            else if (which == 1)
+                arb_sin(s + i, x + i, prec);
+            else
+                arb_cos(c + i, x + i, prec);
+        }
+
+        if (which == 0)
+            _arb_vec_sin_cos(s2, c2, x, len, prec);
+        else if (which == 1)
+            _arb_vec_sin_cos(s2, NULL, x, len, prec);
+        else
+            _arb_vec_sin_cos(NULL, c2, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if ((which != 2 && !arb_equal(s + i, s2 + i)) ||
+                (which != 1 && !arb_equal(c + i, c2 + i)))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("len = %wd, prec = %wd, i = %wd, which = %d\n\n",
+                    len, prec, i, which);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("s = "); arb_printd(s + i, 30); flint_printf("\n\n");
+                flint_printf("s2 = "); arb_printd(s2 + i, 30); flint_printf("\n\n");
+                flint_printf("c = "); arb_printd(c + i, 30); flint_printf("\n\n");
+                flint_printf("c2 = "); arb_printd(c2 + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(s, len);
+        _arb_vec_clear(c, len);
+        _arb_vec_clear(s2, len);
+        _arb_vec_clear(c2, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
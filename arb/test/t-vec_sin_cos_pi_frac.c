@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_sin_cos_pi_frac....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        arb_ptr s, c;
+        arb_t t, u;
+        fmpq_t x;
+        slong k, len, prec;
+        ulong n;
+        int which;
+
+        n = 1 + n_randint(state, 300);
+        len = n_randint(state, 700);
+        prec = 2 + n_randint(state, 500);
+        which = n_randint(state, 3);
+
+        s = _arb_vec_init(len);
+        c = _arb_vec_init(len);
+        arb_init(t);
+        arb_init(u);
+        fmpq_init(x);
+
+        _arb_vec_sin_cos_pi_frac(which == 1 ? NULL : s,
+            which == 2 ? NULL : c, len, n, prec);
+
+        for (k = 0; k < len; k++)
+        {
+            fmpz_set_si(fmpq_numref(x), k);
+            fmpz_set_ui(fmpq_denref(x), n);
+            fmpq_canonicalise(x);
+            arb_sin_cos_pi_fmpq(t, u, x, prec);
+
+            /* the error is small in absolute terms, so small entries
+               may have up to log2(n) bits less relative accuracy */
+            if ((which != 1 && !arb_overlaps(s + k, t)) ||
+                (which != 2 && !arb_overlaps(c + k, u)) ||
+                (which != 1 && prec > 30 && arb_rel_accuracy_bits(t) >= prec - 2 &&
+                    arb_rel_accuracy_bits(s + k) < prec - 10 - FLINT_BIT_COUNT(n)) ||
+                (which != 2 && prec > 30 && arb_rel_accuracy_bits(u) >= prec - 2 &&
+                    arb_rel_accuracy_bits(c + k) < prec - 10 - FLINT_BIT_COUNT(n)))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("n = %wu, k = %wd, prec = %wd\n\n", n, k, prec);
+                flint_printf("s = "); arb_printd(s + k, 30); flint_printf("\n\n");
+                flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+                flint_printf("c = "); arb_printd(c + k, 30); flint_printf("\n\n");
+                flint_printf("u = "); arb_printd(u, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _arb_vec_clear(s, len);
+        _arb_vec_clear(c, len);
+        arb_clear(t);
+        arb_clear(u);
+        fmpq_clear(x);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "arb.h"
+
+/*
+    Algorithm selection thresholds, with one value for each of the
+    precision tiers (0, 128], (128, 512], (512, 2048], (2048, 8192]
+    and (8192, infinity). The defaults can be replaced by values
+    measured with the tune program (arb/tune/thresholds.c), which writes
+    a file that can be read with arb_tune_load().
+*/
+
+#define ARB_TUNE_DEFAULTS \
+{ \
+    { 16, 16, 16, 16, 16 }, \
+    { 4, 4, 4, 4, 4 }, \
+    { 16, 16, 16, 16, 16 }, \
+    { 60, 60, 60, 60, 60 }, \
+    { 14, 14, 14, 14, 14 }, \
+    { 32, 32, 32, 32, 32 }, \
+    { 100000, 100000, 100000, 100000, 100000 }, \
+    { 0, 0, 0, 32, 256 } \
+}
+
+static const slong arb_tune_default[ARB_TUNE_NUM][ARB_TUNE_TIERS] =
+    ARB_TUNE_DEFAULTS;
+
+static const char * arb_tune_names[ARB_TUNE_NUM] =
+{
+    "poly_mullow_block",
+    "acb_poly_mullow_transpose",
+    "acb_poly_mullow_block",
+    "exp_sinh_terms",
+    "sin_cos_sqrt_terms",
+    "mat_mul_block",
+    "mat_mul_threaded_work",
+    "fmpq_bs_bits",
+};
+
+slong arb_tune_tab[ARB_TUNE_NUM][ARB_TUNE_TIERS] = ARB_TUNE_DEFAULTS;
+
+void
+arb_tune_set(arb_tune_param_t param, slong prec, slong value)
+{
+    arb_tune_tab[param][arb_tune_tier(prec)] = value;
+}
+
+void
+arb_tune_reset(void)
+{
+    memcpy(arb_tune_tab, arb_tune_default, sizeof(arb_tune_tab));
+}
+
+const char *
+arb_tune_param_name(arb_tune_param_t param)
+{
+    return arb_tune_names[param];
+}
+
+int
+arb_tune_load(const char * filename)
+{
+    slong tab[ARB_TUNE_NUM][ARB_TUNE_TIERS];
+    char line[256], name[64];
+    long v[ARB_TUNE_TIERS];
+    FILE * fp;
+    int i, j, ok;
+
+    fp = fopen(filename, "r");
+
+    if (fp == NULL)
+        return 0;
+
+    memcpy(tab, arb_tune_tab, sizeof(tab));
+    ok = 1;
+
+    while (ok && fgets(line, sizeof(line), fp) != NULL)
+    {
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+
+        if (sscanf(line, "%63s %ld %ld %ld %ld %ld", name,
+                v, v + 1, v + 2, v + 3, v + 4) != 1 + ARB_TUNE_TIERS)
+        {
+            ok = 0;
+            break;
+        }
+
+        /* ignore parameters that this version does not know */
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+        {
+            if (strcmp(name, arb_tune_names[i]) == 0)
+            {
+                for (j = 0; j < ARB_TUNE_TIERS; j++)
+                    tab[i][j] = v[j];
+                break;
+            }
+        }
+    }
+
+    fclose(fp);
+
+    if (ok)
+        memcpy(arb_tune_tab, tab, sizeof(tab));
+
+    return ok;
+}
+
+int
+arb_tune_save(const char * filename)
+{
+    FILE * fp;
+    int i, j, ok;
+
+    fp = fopen(filename, "w");
+
+    if (fp == NULL)
+        return 0;
+
+    fprintf(fp, "# arb tuning table, one column per precision tier:\n");
+    fprintf(fp, "# <= 128, <= 512, <= 2048, <= 8192, > 8192 bits\n");
+
+    for (i = 0; i < ARB_TUNE_NUM; i++)
+    {
+        fprintf(fp, "%s", arb_tune_names[i]);
+        for (j = 0; j < ARB_TUNE_TIERS; j++)
+            fprintf(fp, " %ld", (long) arb_tune_tab[i][j]);
+        fprintf(fp, "\n");
+    }
+
+    ok = (ferror(fp) == 0);
+    ok = (fclose(fp) == 0) && ok;
+
+    return ok;
+}
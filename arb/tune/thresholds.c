@@ -0,0 +1,410 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdlib.h>
+#include <time.h>
+#include "arb_poly.h"
+#include "acb_poly.h"
+#include "arb_mat.h"
+
+/*
+    Measures the algorithm selection thresholds in arb_tune_tab for the
+    representative precision of each tier and writes them to the file
+    given as the first argument (default arb_tune.txt), which can then
+    be read with arb_tune_load(). The optional second argument is the
+    number of threads to tune for (default 1); the threaded matrix
+    multiplication threshold is only measured with more than one thread.
+
+    The first tier is measured above ARB_DD_AUTO_PREC, since below it
+    the double-double code is used regardless of the tuning values.
+*/
+
+static const slong tier_prec[ARB_TUNE_TIERS] = { 112, 256, 1024, 4096, 16384 };
+
+static const slong sizes[] = { 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128 };
+
+#define NUM_SIZES (sizeof(sizes) / sizeof(slong))
+
+/* candidate thresholds for the number of Taylor series terms */
+static const slong terms[] = { 0, 8, 10, 14, 20, 30, 40, 60, 80, 120, WORD_MAX };
+
+#define NUM_TERMS (sizeof(terms) / sizeof(slong))
+
+/* candidate thresholds for the bit size of rational arguments */
+static const slong fmpq_bits[] = { 16, 32, 64, 128, 256, 512, 1024 };
+
+#define NUM_FMPQ_BITS (sizeof(fmpq_bits) / sizeof(slong))
+
+/* number of rational arguments timed together */
+#define NUM_FMPQ 8
+
+#define MIN_TIME 0.02
+
+typedef struct
+{
+    int alg;
+    slong len;
+    slong prec;
+    arb_ptr a, b, c;
+    acb_ptr x, y, z;
+    fmpq * q;
+    arb_mat_struct * A;
+    arb_mat_struct * B;
+    arb_mat_struct * C;
+}
+tune_arg_struct;
+
+static void
+run_arb_poly(tune_arg_struct * arg)
+{
+    if (arg->alg == 0)
+        _arb_poly_mullow_classical(arg->c, arg->a, arg->len,
+            arg->b, arg->len, arg->len, arg->prec);
+    else
+        _arb_poly_mullow_block(arg->c, arg->a, arg->len,
+            arg->b, arg->len, arg->len, arg->prec);
+}
+
+static void
+run_acb_poly(tune_arg_struct * arg)
+{
+    if (arg->alg == 0)
+        _acb_poly_mullow_classical(arg->z, arg->x, arg->len,
+            arg->y, arg->len, arg->len, arg->prec);
+    else if (arg->alg == 1)
+        _acb_poly_mullow_transpose(arg->z, arg->x, arg->len,
+            arg->y, arg->len, arg->len, arg->prec);
+    else
+        _acb_poly_mullow_block(arg->z, arg->x, arg->len,
+            arg->y, arg->len, arg->len, arg->prec);
+}
+
+static void
+run_exp(tune_arg_struct * arg)
+{
+    slong i;
+
+    for (i = 0; i < arg->len; i++)
+        arb_exp(arg->c + i, arg->a + i, arg->prec);
+}
+
+static void
+run_sin_cos(tune_arg_struct * arg)
+{
+    slong i;
+
+    for (i = 0; i < arg->len; i++)
+        arb_sin_cos(arg->b + i, arg->c + i, arg->a + i, arg->prec);
+}
+
+static void
+run_fmpq(tune_arg_struct * arg)
+{
+    slong i;
+
+    for (i = 0; i < arg->len; i++)
+    {
+        arb_exp_fmpq(arg->c + i, arg->q + i, arg->prec);
+        arb_log_fmpq(arg->c + i, arg->q + i, arg->prec);
+        arb_atan_fmpq(arg->c + i, arg->q + i, arg->prec);
+    }
+}
+
+static void
+run_arb_mat(tune_arg_struct * arg)
+{
+    if (arg->alg == 0)
+        arb_mat_mul_classical(arg->C, arg->A, arg->B, arg->prec);
+    else if (arg->alg == 1)
+        arb_mat_mul_block(arg->C, arg->A, arg->B, arg->prec);
+    else
+        arb_mat_mul_threaded(arg->C, arg->A, arg->B, arg->prec);
+}
+
+static double
+wall_time(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+/* wall-clock seconds per call, repeating until at least MIN_TIME seconds
+   have passed; process CPU time would count every worker thread */
+static double
+time_call(void (*func)(tune_arg_struct *), tune_arg_struct * arg)
+{
+    double t0, t1;
+    slong reps, i;
+
+    for (reps = 1; ; reps *= 2)
+    {
+        t0 = wall_time();
+        for (i = 0; i < reps; i++)
+            func(arg);
+        t1 = wall_time();
+
+        if (t1 - t0 >= MIN_TIME)
+            return (t1 - t0) / reps;
+    }
+}
+
+/* smallest size at which algorithm alg beats algorithm 0 */
+static slong
+crossover(void (*func)(tune_arg_struct *), tune_arg_struct * arg,
+    int alg, slong max_size, flint_rand_t state)
+{
+    slong i, j;
+    double t0, t1;
+
+    for (i = 0; i < NUM_SIZES && sizes[i] <= max_size; i++)
+    {
+        arg->len = sizes[i];
+
+        if (func == run_arb_poly)
+        {
+            for (j = 0; j < arg->len; j++)
+            {
+                arb_randtest(arg->a + j, state, arg->prec, 4);
+                arb_randtest(arg->b + j, state, arg->prec, 4);
+            }
+        }
+        else if (func == run_acb_poly)
+        {
+            for (j = 0; j < arg->len; j++)
+            {
+                acb_randtest(arg->x + j, state, arg->prec, 4);
+                acb_randtest(arg->y + j, state, arg->prec, 4);
+            }
+        }
+        else
+        {
+            arb_mat_clear(arg->A);
+            arb_mat_clear(arg->B);
+            arb_mat_clear(arg->C);
+            arb_mat_init(arg->A, arg->len, arg->len);
+            arb_mat_init(arg->B, arg->len, arg->len);
+            arb_mat_init(arg->C, arg->len, arg->len);
+            arb_mat_randtest(arg->A, state, arg->prec, 4);
+            arb_mat_randtest(arg->B, state, arg->prec, 4);
+        }
+
+        arg->alg = 0;
+        t0 = time_call(func, arg);
+        arg->alg = alg;
+        t1 = time_call(func, arg);
+
+        if (t1 < t0)
+            return sizes[i];
+    }
+
+    return max_size + 1;
+}
+
+/* the candidate threshold for param giving the fastest evaluation */
+static slong
+best_terms(void (*func)(tune_arg_struct *), tune_arg_struct * arg,
+    arb_tune_param_t param)
+{
+    slong i, best;
+    double t, best_time;
+
+    best = arb_tune_get(param, arg->prec);
+    best_time = 0.0;
+
+    for (i = 0; i < NUM_TERMS; i++)
+    {
+        arb_tune_set(param, arg->prec, terms[i]);
+        t = time_call(func, arg);
+
+        if (i == 0 || t < best_time)
+        {
+            best = terms[i];
+            best_time = t;
+        }
+    }
+
+    arb_tune_set(param, arg->prec, best);
+    return best;
+}
+
+/* largest total bit size of a rational argument for which summing the
+   series directly by binary splitting beats the generic algorithm */
+static slong
+fmpq_crossover(tune_arg_struct * arg, flint_rand_t state)
+{
+    slong i, j, best;
+    double t0, t1;
+
+    best = 0;
+    arg->len = NUM_FMPQ;
+
+    for (i = 0; i < NUM_FMPQ_BITS; i++)
+    {
+        for (j = 0; j < arg->len; j++)
+        {
+            fmpz_randbits(fmpq_numref(arg->q + j), state, fmpq_bits[i] / 2);
+            fmpz_randbits(fmpq_denref(arg->q + j), state, fmpq_bits[i] / 2);
+            fmpz_abs(fmpq_numref(arg->q + j), fmpq_numref(arg->q + j));
+            fmpz_abs(fmpq_denref(arg->q + j), fmpq_denref(arg->q + j));
+            fmpq_canonicalise(arg->q + j);
+        }
+
+        arb_tune_set(ARB_TUNE_FMPQ_BS_BITS, arg->prec, 0);
+        t0 = time_call(run_fmpq, arg);
+        arb_tune_set(ARB_TUNE_FMPQ_BS_BITS, arg->prec, WORD_MAX);
+        t1 = time_call(run_fmpq, arg);
+
+        if (t1 >= t0)
+            break;
+
+        best = fmpq_bits[i];
+    }
+
+    arb_tune_set(ARB_TUNE_FMPQ_BS_BITS, arg->prec, best);
+    return best;
+}
+
+int main(int argc, char * argv[])
+{
+    const char * filename;
+    tune_arg_struct arg;
+    flint_rand_t state;
+    arb_mat_t A, B, C;
+    slong i, k, n, prec, max_size;
+    double work;
+
+    filename = (argc > 1) ? argv[1] : "arb_tune.txt";
+
+    if (argc > 2)
+        flint_set_num_threads(FLINT_MAX(1, atoi(argv[2])));
+
+    flint_randinit(state);
+
+    max_size = sizes[NUM_SIZES - 1];
+    arg.a = _arb_vec_init(2 * max_size);
+    arg.b = _arb_vec_init(2 * max_size);
+    arg.c = _arb_vec_init(2 * max_size);
+    arg.x = _acb_vec_init(2 * max_size);
+    arg.y = _acb_vec_init(2 * max_size);
+    arg.z = _acb_vec_init(2 * max_size);
+    arg.q = flint_malloc(sizeof(fmpq) * NUM_FMPQ);
+    for (i = 0; i < NUM_FMPQ; i++)
+        fmpq_init(arg.q + i);
+    arb_mat_init(A, 0, 0);
+    arb_mat_init(B, 0, 0);
+    arb_mat_init(C, 0, 0);
+    arg.A = A;
+    arg.B = B;
+    arg.C = C;
+
+    for (k = 0; k < ARB_TUNE_TIERS; k++)
+    {
+        prec = arg.prec = tier_prec[k];
+
+        flint_printf("prec = %wd\n", prec);
+
+        n = crossover(run_arb_poly, &arg, 1, max_size, state);
+        arb_tune_set(ARB_TUNE_POLY_MULLOW_BLOCK, prec, n);
+        flint_printf("    %s %wd\n",
+            arb_tune_param_name(ARB_TUNE_POLY_MULLOW_BLOCK), n);
+
+        n = crossover(run_acb_poly, &arg, 1, max_size, state);
+        arb_tune_set(ARB_TUNE_ACB_POLY_MULLOW_TRANSPOSE, prec, n);
+        flint_printf("    %s %wd\n",
+            arb_tune_param_name(ARB_TUNE_ACB_POLY_MULLOW_TRANSPOSE), n);
+
+        n = crossover(run_acb_poly, &arg, 2, max_size, state);
+        arb_tune_set(ARB_TUNE_ACB_POLY_MULLOW_BLOCK, prec, n);
+        flint_printf("    %s %wd\n",
+            arb_tune_param_name(ARB_TUNE_ACB_POLY_MULLOW_BLOCK), n);
+
+        /* the Taylor series code is only used below the MPFR cutoff */
+        if (prec < ARB_EXP_TAB2_PREC)
+        {
+            arg.len = max_size;
+            for (i = 0; i < arg.len; i++)
+                arb_randtest_exact(arg.a + i, state, prec, 2);
+
+            n = best_terms(run_exp, &arg, ARB_TUNE_EXP_SINH_TERMS);
+            flint_printf("    %s %wd\n",
+                arb_tune_param_name(ARB_TUNE_EXP_SINH_TERMS), n);
+
+            n = best_terms(run_sin_cos, &arg, ARB_TUNE_SIN_COS_SQRT_TERMS);
+            flint_printf("    %s %wd\n",
+                arb_tune_param_name(ARB_TUNE_SIN_COS_SQRT_TERMS), n);
+        }
+
+        if (prec >= 128)
+        {
+            n = crossover(run_arb_mat, &arg, 1, 64, state);
+            arb_tune_set(ARB_TUNE_MAT_MUL_BLOCK, prec, n);
+            flint_printf("    %s %wd\n",
+                arb_tune_param_name(ARB_TUNE_MAT_MUL_BLOCK), n);
+        }
+
+        /* the work estimate is n^3 * prec for n x n matrices */
+        if (flint_get_num_threads() > 1)
+        {
+            n = crossover(run_arb_mat, &arg, 2, 64, state);
+            /* may not fit in an slong on 32-bit systems */
+            work = (double) n * n * n * prec;
+            n = (work >= WORD_MAX) ? WORD_MAX : (slong) work;
+            arb_tune_set(ARB_TUNE_MAT_MUL_THREADED_WORK, prec, n);
+            flint_printf("    %s %wd\n",
+                arb_tune_param_name(ARB_TUNE_MAT_MUL_THREADED_WORK), n);
+        }
+
+        n = fmpq_crossover(&arg, state);
+        flint_printf("    %s %wd\n",
+            arb_tune_param_name(ARB_TUNE_FMPQ_BS_BITS), n);
+    }
+
+    if (!arb_tune_save(filename))
+    {
+        flint_printf("unable to write %s\n", filename);
+        abort();
+    }
+
+    flint_printf("wrote %s\n", filename);
+
+    _arb_vec_clear(arg.a, 2 * max_size);
+    _arb_vec_clear(arg.b, 2 * max_size);
+    _arb_vec_clear(arg.c, 2 * max_size);
+    _acb_vec_clear(arg.x, 2 * max_size);
+    _acb_vec_clear(arg.y, 2 * max_size);
+    _acb_vec_clear(arg.z, 2 * max_size);
+    for (i = 0; i < NUM_FMPQ; i++)
+        fmpq_clear(arg.q + i);
+    flint_free(arg.q);
+    arb_mat_clear(A);
+    arb_mat_clear(B);
+    arb_mat_clear(C);
+    flint_randclear(state);
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* number of radii gathered into contiguous vectors at a time */
+#define RAD_CHUNK 32
+
+static void
+_arb_vec_add_sub(arb_ptr C, arb_srcptr A, arb_srcptr B, slong n,
+    slong prec, int negate)
+{
+    mag_struct xr[RAD_CHUNK], yr[RAD_CHUNK], zr[RAD_CHUNK];
+    arf_ptr zm;
+    slong i, k, m;
+    int inexact;
+
+    for (i = 0; i < n; i += m)
+    {
+        m = FLINT_MIN(RAD_CHUNK, n - i);
+
+        /* shallow copies, read before C (which may alias A or B)
+           is written to */
+        for (k = 0; k < m; k++)
+        {
+            xr[k] = *arb_radref(A + i + k);
+            yr[k] = *arb_radref(B + i + k);
+            mag_init(zr + k);
+        }
+
+        _mag_vec_add(zr, xr, yr, m);
+
+        for (k = 0; k < m; k++)
+        {
+            zm = arb_midref(C + i + k);
+
+            if (ARF_IS_LAGOM(zm))
+                inexact = _arf_add_fast(zm, arb_midref(A + i + k),
+                    arb_midref(B + i + k), negate, prec, ARB_RND);
+            else if (negate)
+                inexact = arf_sub(zm, arb_midref(A + i + k),
+                    arb_midref(B + i + k), prec, ARB_RND);
+            else
+                inexact = arf_add(zm, arb_midref(A + i + k),
+                    arb_midref(B + i + k), prec, ARB_RND);
+
+            mag_swap(arb_radref(C + i + k), zr + k);
+            mag_clear(zr + k);
+
+            if (inexact)
+                arf_mag_add_ulp(arb_radref(C + i + k),
+                    arb_radref(C + i + k), zm, prec);
+        }
+    }
+}
+
+void
+_arb_vec_add(arb_ptr C, arb_srcptr A, arb_srcptr B, slong n, slong prec)
+{
+    _arb_vec_add_sub(C, A, B, n, prec, 0);
+}
+
+void
+_arb_vec_sub(arb_ptr C, arb_srcptr A, arb_srcptr B, slong n, slong prec)
+{
+    _arb_vec_add_sub(C, A, B, n, prec, 1);
+}
@@ -0,0 +1,55 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* number of radii gathered into contiguous vectors at a time */
+#define RAD_CHUNK 32
+
+void
+_arb_vec_add_error_mag_vec(arb_ptr res, mag_srcptr err, slong len)
+{
+    mag_struct xr[RAD_CHUNK], zr[RAD_CHUNK];
+    slong i, k, m;
+
+    for (i = 0; i < len; i += m)
+    {
+        m = FLINT_MIN(RAD_CHUNK, len - i);
+
+        for (k = 0; k < m; k++)
+        {
+            xr[k] = *arb_radref(res + i + k);
+            mag_init(zr + k);
+        }
+
+        _mag_vec_add(zr, xr, err + i, m);
+
+        for (k = 0; k < m; k++)
+        {
+            mag_swap(arb_radref(res + i + k), zr + k);
+            mag_clear(zr + k);
+        }
+    }
+}
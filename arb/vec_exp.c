@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+#include "arb_thread_pool.h"
+
+/* minimum number of entries per thread */
+#define MIN_CHUNK 32
+
+typedef struct
+{
+    arb_ptr res;
+    arb_srcptr x;
+    slong len;
+    slong prec;
+}
+vec_exp_arg_t;
+
+static void
+_arb_vec_exp_serial(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        arb_exp(res + i, x + i, prec);
+}
+
+static void
+_arb_vec_exp_worker(void * arg_ptr)
+{
+    vec_exp_arg_t * arg = (vec_exp_arg_t *) arg_ptr;
+
+    _arb_vec_exp_serial(arg->res, arg->x, arg->len, arg->prec);
+}
+
+void
+_arb_vec_exp(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    vec_exp_arg_t * args;
+    slong i, a, b, num_threads, num;
+
+    num_threads = flint_get_num_threads();
+    num = FLINT_MIN(4 * num_threads, len / MIN_CHUNK);
+
+    if (num_threads == 1 || num <= 1)
+    {
+        _arb_vec_exp_serial(res, x, len, prec);
+        return;
+    }
+
+    args = flint_malloc(sizeof(vec_exp_arg_t) * num);
+
+    for (i = 0; i < num; i++)
+    {
+        a = (len * i) / num;
+        b = (len * (i + 1)) / num;
+
+        args[i].res = res + a;
+        args[i].x = x + a;
+        args[i].len = b - a;
+        args[i].prec = prec;
+    }
+
+    arb_thread_pool_run(_arb_vec_exp_worker, args, sizeof(vec_exp_arg_t), num);
+
+    flint_free(args);
+}
+
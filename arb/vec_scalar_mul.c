@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* number of radii gathered into contiguous vectors at a time */
+#define RAD_CHUNK 32
+
+void
+_arb_vec_scalar_mul(arb_ptr res, arb_srcptr vec,
+    slong len, const arb_t c, slong prec)
+{
+    mag_struct xr[RAD_CHUNK], xm[RAD_CHUNK], zr[RAD_CHUNK];
+    mag_struct cr[RAD_CHUNK], cm[RAD_CHUNK];
+    mag_t cmag;
+    arb_t t;
+    slong i, k, m;
+    int inexact, exact;
+
+    if (len < 4)
+    {
+        for (i = 0; i < len; i++)
+            arb_mul(res + i, vec + i, c, prec);
+        return;
+    }
+
+    /* c may be an entry of res */
+    arb_init(t);
+    arb_set(t, c);
+    mag_init_set_arf(cmag, arb_midref(t));
+    exact = arb_is_exact(t);
+
+    /* shallow copies of the magnitudes of c */
+    for (k = 0; k < RAD_CHUNK; k++)
+    {
+        cm[k] = *cmag;
+        cr[k] = *arb_radref(t);
+    }
+
+    for (i = 0; i < len; i += m)
+    {
+        m = FLINT_MIN(RAD_CHUNK, len - i);
+
+        for (k = 0; k < m; k++)
+        {
+            xr[k] = *arb_radref(vec + i + k);
+            mag_init(zr + k);
+        }
+
+        /* |c| xr, plus |x| cr + xr cr if c is inexact */
+        _mag_vec_mul(zr, cm, xr, m);
+
+        if (!exact)
+        {
+            for (k = 0; k < m; k++)
+                mag_init_set_arf(xm + k, arb_midref(vec + i + k));
+
+            _mag_vec_addmul(zr, xm, cr, m);
+            _mag_vec_addmul(zr, xr, cr, m);
+
+            for (k = 0; k < m; k++)
+                mag_clear(xm + k);
+        }
+
+        for (k = 0; k < m; k++)
+        {
+            inexact = arf_mul(arb_midref(res + i + k),
+                arb_midref(vec + i + k), arb_midref(t), prec, ARB_RND);
+
+            mag_swap(arb_radref(res + i + k), zr + k);
+            mag_clear(zr + k);
+
+            if (inexact)
+                arf_mag_add_ulp(arb_radref(res + i + k),
+                    arb_radref(res + i + k), arb_midref(res + i + k), prec);
+        }
+    }
+
+    mag_clear(cmag);
+    arb_clear(t);
+}
@@ -0,0 +1,205 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb.h"
+
+/* (c, s) = (c, s) * (C, S), i.e. rotate by the angle of (C, S) */
+static void
+_arb_rotate(arb_t c, arb_t s, const arb_t c0, const arb_t s0,
+    const arb_t C, const arb_t S, arb_t t, slong prec)
+{
+    arb_mul(t, c0, S, prec);
+    arb_mul(s, s0, C, prec);
+    arb_add(s, s, t, prec);
+    arb_mul(t, s0, S, prec);
+    arb_mul(c, c0, C, prec);
+    arb_sub(c, c, t, prec);
+}
+
+static void
+_arb_sin_cos_2pi_fmpq_ui(arb_t s, arb_t c, ulong p, ulong q, slong prec)
+{
+    fmpq_t x;
+    fmpq_init(x);
+    fmpz_set_ui(fmpq_numref(x), p % q);
+    fmpz_mul_2exp(fmpq_numref(x), fmpq_numref(x), 1);
+    fmpz_set_ui(fmpq_denref(x), q);
+    fmpq_canonicalise(x);
+    arb_sin_cos_pi_fmpq(s, c, x, prec);
+    fmpq_clear(x);
+}
+
+/*
+    Sets (c[k], s[k]) = (cos, sin)(2 pi k / n) for 0 <= k <= m, where
+    m < n. The points k = j B are computed by repeated multiplication
+    by exp(2 pi i B / n) and the points in between by repeated
+    multiplication by exp(2 pi i / n), so that each entry is the result
+    of at most m / B + B multiplications.
+*/
+static void
+_arb_sin_cos_2pi_frac_recurrence(arb_ptr s, arb_ptr c, slong m,
+    ulong n, slong prec)
+{
+    arb_t C1, S1, CB, SB, t;
+    slong B, j, k, wp;
+
+    arb_one(c);
+    arb_zero(s);
+
+    if (m == 0)
+        return;
+
+    B = n_sqrt(m) + 1;
+    wp = prec + FLINT_BIT_COUNT(B) + 8;
+
+    arb_init(C1);
+    arb_init(S1);
+    arb_init(CB);
+    arb_init(SB);
+    arb_init(t);
+
+    _arb_sin_cos_2pi_fmpq_ui(S1, C1, 1, n, wp);
+
+    if (B <= m)
+        _arb_sin_cos_2pi_fmpq_ui(SB, CB, B, n, wp);
+
+    for (j = 0; j <= m; j += B)
+    {
+        if (j != 0)
+            _arb_rotate(c + j, s + j, c + j - B, s + j - B, CB, SB, t, wp);
+
+        for (k = j + 1; k < j + B && k <= m; k++)
+            _arb_rotate(c + k, s + k, c + k - 1, s + k - 1, C1, S1, t, wp);
+    }
+
+    arb_clear(C1);
+    arb_clear(S1);
+    arb_clear(CB);
+    arb_clear(SB);
+    arb_clear(t);
+}
+
+void
+_arb_vec_sin_cos_2pi_frac(arb_ptr res_sin, arb_ptr res_cos, slong len,
+    ulong n, slong prec)
+{
+    arb_ptr s, c;
+    slong i, k, m, T;
+
+    if (len <= 0)
+        return;
+
+    if (n == 0)
+    {
+        flint_printf("exception: _arb_vec_sin_cos_2pi_frac: n = 0\n");
+        abort();
+    }
+
+    /* one period, or less */
+    T = (n < (ulong) len) ? n : len;
+
+    s = (res_sin != NULL) ? res_sin : _arb_vec_init(T);
+    c = (res_cos != NULL) ? res_cos : _arb_vec_init(T);
+
+    /* compute up to the first symmetry point, and use exact symmetries
+       for the rest of the period */
+    if (n % 4 == 0)
+        m = n / 8;
+    else if (n % 2 == 0)
+        m = n / 4;
+    else
+        m = n / 2;
+
+    m = FLINT_MIN(m, T - 1);
+
+    _arb_sin_cos_2pi_frac_recurrence(s, c, m, n, prec);
+
+    for (k = m + 1; k < T; k++)
+    {
+        if (n % 4 == 0)
+        {
+            if ((ulong) k <= n / 4)
+            {
+                /* exp(i(pi/2 - x)) = sin(x) + i cos(x) */
+                arb_set(c + k, s + n / 4 - k);
+                arb_set(s + k, c + n / 4 - k);
+            }
+            else
+            {
+                /* multiply by i */
+                arb_neg(c + k, s + k - n / 4);
+                arb_set(s + k, c + k - n / 4);
+            }
+        }
+        else if (n % 2 == 0)
+        {
+            if ((ulong) k <= n / 2)
+            {
+                /* exp(i(pi - x)) = -cos(x) + i sin(x) */
+                arb_neg(c + k, c + n / 2 - k);
+                arb_set(s + k, s + n / 2 - k);
+            }
+            else
+            {
+                arb_neg(c + k, c + k - n / 2);
+                arb_neg(s + k, s + k - n / 2);
+            }
+        }
+        else
+        {
+            /* exp(i(2 pi - x)) = cos(x) - i sin(x) */
+            arb_set(c + k, c + n - k);
+            arb_neg(s + k, s + n - k);
+        }
+    }
+
+    for (k = 0; k < T; k++)
+    {
+        arb_set_round(s + k, s + k, prec);
+        arb_set_round(c + k, c + k, prec);
+    }
+
+    /* periodic continuation */
+    for (i = T; i < len; i++)
+    {
+        if (res_sin != NULL)
+            arb_set(res_sin + i, res_sin + i % n);
+        if (res_cos != NULL)
+            arb_set(res_cos + i, res_cos + i % n);
+    }
+
+    if (res_sin == NULL)
+        _arb_vec_clear(s, T);
+    if (res_cos == NULL)
+        _arb_vec_clear(c, T);
+}
+
+void
+_arb_vec_sin_cos_pi_frac(arb_ptr res_sin, arb_ptr res_cos, slong len,
+    ulong n, slong prec)
+{
+    _arb_vec_sin_cos_2pi_frac(res_sin, res_cos, len, 2 * n, prec);
+}
+
@@ -0,0 +1,467 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#ifndef ARB_DD_H
+#define ARB_DD_H
+
+#ifdef ARB_DD_INLINES_C
+#define ARB_DD_INLINE
+#else
+#define ARB_DD_INLINE static __inline__
+#endif
+
+#include <math.h>
+#include "arb.h"
+#include "double_extras.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    A ball whose midpoint is the unevaluated sum hi + lo of two doubles
+    with |lo| <= ulp(hi) / 2, and whose radius is a double. The basic
+    operations compute the midpoint with the usual double-double
+    algorithms and add a bound for their rounding error to the radius.
+    All radius computations are done with rounding to nearest, and are
+    made safe by inflating the result by ARB_DD_UP and adding ARB_DD_TINY
+    (which also absorbs the absolute error caused by underflow). The
+    constants are chosen so that no subnormal numbers appear in normal
+    use, since arithmetic on them is very slow on many processors.
+*/
+typedef struct
+{
+    double hi;
+    double lo;
+    double rad;
+}
+arb_dd_struct;
+
+typedef arb_dd_struct arb_dd_t[1];
+typedef arb_dd_struct * arb_dd_ptr;
+typedef const arb_dd_struct * arb_dd_srcptr;
+
+#define ARB_DD_PREC 106
+
+/* arb_exp, arb_log, arb_sin_cos etc. use this module for exact input
+   up to this precision; double arithmetic must not be carried out
+   in extended precision for the error bounds to be valid */
+#if defined(__FLT_EVAL_METHOD__) && (__FLT_EVAL_METHOD__ != 0)
+#define ARB_DD_AUTO_PREC 0
+#else
+#define ARB_DD_AUTO_PREC 80
+#endif
+
+/* relative error bounds for the midpoint operations; the proved
+   bounds are 3u^2, 5u^2 and 15u^2 + 56u^3 where u = 2^-53 */
+#define ARB_DD_ADD_ERR 1.9721522630525295e-31   /* 2^-102 */
+#define ARB_DD_MUL_ERR 1.9721522630525295e-31   /* 2^-102 */
+#define ARB_DD_DIV_ERR 7.888609052210118e-31    /* 2^-100 */
+
+#define ARB_DD_UP 1.0000000000000036            /* 1 + 2^-48 */
+#define ARB_DD_DOWN 0.9999999999999964          /* 1 - 2^-48 */
+#define ARB_DD_TINY 1.0020841800044864e-292    /* 2^-970 */
+#define ARB_DD_SMALL 1.1830521861667747e-271    /* 2^-900 */
+
+#define ARB_DD_IS_FINITE(x) ((x) - (x) == 0.0)
+
+/* helper functions for the midpoint arithmetic */
+
+ARB_DD_INLINE double
+_arb_dd_up(double t)
+{
+    return t * ARB_DD_UP + ARB_DD_TINY;
+}
+
+/* s + e = a + b exactly */
+ARB_DD_INLINE void
+_arb_dd_two_sum(double * s, double * e, double a, double b)
+{
+    double t, u;
+
+    t = a + b;
+    u = t - a;
+    *e = (a - (t - u)) + (b - u);
+    *s = t;
+}
+
+/* s + e = a + b exactly, assuming that |a| >= |b| */
+ARB_DD_INLINE void
+_arb_dd_fast_two_sum(double * s, double * e, double a, double b)
+{
+    double t;
+
+    t = a + b;
+    *e = b - (t - a);
+    *s = t;
+}
+
+/* p + e = a * b exactly, barring underflow */
+ARB_DD_INLINE void
+_arb_dd_two_prod(double * p, double * e, double a, double b)
+{
+#if defined(__GNUC__) && defined(__FMA__)
+    double t;
+
+    t = a * b;
+    *e = __builtin_fma(a, b, -t);
+    *p = t;
+#else
+    double t, ah, al, bh, bl;
+
+    t = 134217729.0 * a;
+    ah = t - (t - a);
+    al = a - ah;
+    t = 134217729.0 * b;
+    bh = t - (t - b);
+    bl = b - bh;
+    t = a * b;
+    *e = ((ah * bh - t) + ah * bl + al * bh) + al * bl;
+    *p = t;
+#endif
+}
+
+ARB_DD_INLINE void
+_arb_dd_add_mid(double * zh, double * zl,
+    double xh, double xl, double yh, double yl)
+{
+    double sh, sl, th, tl;
+
+    _arb_dd_two_sum(&sh, &sl, xh, yh);
+    _arb_dd_two_sum(&th, &tl, xl, yl);
+    sl += th;
+    _arb_dd_fast_two_sum(&sh, &sl, sh, sl);
+    sl += tl;
+    _arb_dd_fast_two_sum(zh, zl, sh, sl);
+}
+
+ARB_DD_INLINE void
+_arb_dd_mul_mid(double * zh, double * zl,
+    double xh, double xl, double yh, double yl)
+{
+    double ch, cl;
+
+    _arb_dd_two_prod(&ch, &cl, xh, yh);
+    cl += xh * yl + xl * yh;
+    _arb_dd_fast_two_sum(zh, zl, ch, cl);
+}
+
+ARB_DD_INLINE void
+_arb_dd_div_mid(double * zh, double * zl,
+    double xh, double xl, double yh, double yl)
+{
+    double th, tl, rh, rl, e;
+
+    th = xh / yh;
+
+    /* r = y * th */
+    _arb_dd_two_prod(&rh, &rl, yh, th);
+    e = yl * th;
+    _arb_dd_fast_two_sum(&rh, &e, rh, e);
+    rl += e;
+    _arb_dd_fast_two_sum(&rh, &rl, rh, rl);
+
+    tl = ((xh - rh) + (xl - rl)) / yh;
+    _arb_dd_fast_two_sum(zh, zl, th, tl);
+}
+
+/* memory management and special values */
+
+ARB_DD_INLINE void
+arb_dd_zero(arb_dd_t x)
+{
+    x->hi = x->lo = x->rad = 0.0;
+}
+
+ARB_DD_INLINE void
+arb_dd_one(arb_dd_t x)
+{
+    x->hi = 1.0;
+    x->lo = x->rad = 0.0;
+}
+
+ARB_DD_INLINE void
+arb_dd_zero_pm_inf(arb_dd_t x)
+{
+    x->hi = x->lo = 0.0;
+    x->rad = D_INF;
+}
+
+ARB_DD_INLINE void
+arb_dd_indeterminate(arb_dd_t x)
+{
+    x->hi = x->lo = D_NAN;
+    x->rad = D_INF;
+}
+
+ARB_DD_INLINE void
+arb_dd_set(arb_dd_t y, const arb_dd_t x)
+{
+    *y = *x;
+}
+
+ARB_DD_INLINE void
+arb_dd_set_d(arb_dd_t x, double c)
+{
+    x->hi = c;
+    x->lo = x->rad = 0.0;
+}
+
+ARB_DD_INLINE int
+arb_dd_is_finite(const arb_dd_t x)
+{
+    return ARB_DD_IS_FINITE(x->hi) && ARB_DD_IS_FINITE(x->lo)
+        && ARB_DD_IS_FINITE(x->rad);
+}
+
+/* the radius is at most 2^-prec times the absolute value of the midpoint */
+ARB_DD_INLINE int
+arb_dd_is_accurate(const arb_dd_t x, slong prec)
+{
+    return arb_dd_is_finite(x) && x->rad <= ldexp(fabs(x->hi), -prec);
+}
+
+ARB_DD_INLINE int
+arb_dd_is_exact(const arb_dd_t x)
+{
+    return x->rad == 0.0;
+}
+
+/* upper bound for the absolute value */
+ARB_DD_INLINE double
+arb_dd_abs_bound(const arb_dd_t x)
+{
+    return _arb_dd_up(fabs(x->hi) + x->rad);
+}
+
+ARB_DD_INLINE void
+arb_dd_add_error_d(arb_dd_t x, double err)
+{
+    x->rad = _arb_dd_up(x->rad + err);
+}
+
+/* conversions */
+
+int arb_dd_set_arf(arb_dd_t res, const arf_t x);
+
+int arb_dd_set_arb(arb_dd_t res, const arb_t x);
+
+void arb_dd_get_arb(arb_t res, const arb_dd_t x);
+
+/* arithmetic */
+
+ARB_DD_INLINE void
+arb_dd_neg(arb_dd_t y, const arb_dd_t x)
+{
+    y->hi = -x->hi;
+    y->lo = -x->lo;
+    y->rad = x->rad;
+}
+
+ARB_DD_INLINE void
+_arb_dd_add(arb_dd_t z, const arb_dd_t x, double yh, double yl, double yr)
+{
+    double zh, zl, r;
+
+    if (x->lo == 0.0 && yl == 0.0)
+    {
+        _arb_dd_two_sum(&zh, &zl, x->hi, yh);
+        r = x->rad + yr;
+        if (r != 0.0)
+            r = _arb_dd_up(r);
+    }
+    else
+    {
+        _arb_dd_add_mid(&zh, &zl, x->hi, x->lo, yh, yl);
+        r = _arb_dd_up(x->rad + yr + ARB_DD_ADD_ERR * fabs(zh));
+    }
+
+    z->hi = zh;
+    z->lo = zl;
+    z->rad = r;
+}
+
+ARB_DD_INLINE void
+arb_dd_add(arb_dd_t z, const arb_dd_t x, const arb_dd_t y)
+{
+    _arb_dd_add(z, x, y->hi, y->lo, y->rad);
+}
+
+ARB_DD_INLINE void
+arb_dd_sub(arb_dd_t z, const arb_dd_t x, const arb_dd_t y)
+{
+    _arb_dd_add(z, x, -y->hi, -y->lo, y->rad);
+}
+
+ARB_DD_INLINE void
+arb_dd_mul(arb_dd_t z, const arb_dd_t x, const arb_dd_t y)
+{
+    double zh, zl, r;
+
+    r = fabs(x->hi) * y->rad + fabs(y->hi) * x->rad + x->rad * y->rad;
+
+    if (x->lo == 0.0 && y->lo == 0.0)
+    {
+        _arb_dd_two_prod(&zh, &zl, x->hi, y->hi);
+        if (r != 0.0 || (zh != 0.0 && fabs(zh) < ARB_DD_SMALL))
+            r = _arb_dd_up(r);
+    }
+    else
+    {
+        _arb_dd_mul_mid(&zh, &zl, x->hi, x->lo, y->hi, y->lo);
+        r = _arb_dd_up(r + ARB_DD_MUL_ERR * fabs(zh));
+    }
+
+    z->hi = zh;
+    z->lo = zl;
+    z->rad = r;
+}
+
+ARB_DD_INLINE void
+arb_dd_addmul(arb_dd_t z, const arb_dd_t x, const arb_dd_t y)
+{
+    arb_dd_t t;
+    arb_dd_mul(t, x, y);
+    arb_dd_add(z, z, t);
+}
+
+ARB_DD_INLINE void
+arb_dd_submul(arb_dd_t z, const arb_dd_t x, const arb_dd_t y)
+{
+    arb_dd_t t;
+    arb_dd_mul(t, x, y);
+    arb_dd_sub(z, z, t);
+}
+
+ARB_DD_INLINE void
+arb_dd_div(arb_dd_t z, const arb_dd_t x, const arb_dd_t y)
+{
+    double zh, zl, d;
+
+    /* lower bound for |y| */
+    d = (fabs(y->hi) * ARB_DD_DOWN - y->rad * ARB_DD_UP) * ARB_DD_DOWN;
+
+    if (!(d > ARB_DD_SMALL))
+    {
+        arb_dd_indeterminate(z);
+        return;
+    }
+
+    _arb_dd_div_mid(&zh, &zl, x->hi, x->lo, y->hi, y->lo);
+
+    /* |x/y - xm/ym| <= (xr + |xm/ym| yr) / (|ym| - yr) */
+    z->rad = _arb_dd_up(_arb_dd_up(x->rad + fabs(zh) * y->rad) / d
+        + ARB_DD_DIV_ERR * fabs(zh));
+    z->hi = zh;
+    z->lo = zl;
+}
+
+ARB_DD_INLINE void
+arb_dd_mul_2exp_si(arb_dd_t z, const arb_dd_t x, slong e)
+{
+    double h, l, r, c;
+    int f;
+
+    f = FLINT_MAX(FLINT_MIN(e, 4096), -4096);
+
+    if (f >= -1000 && f <= 1000)
+    {
+        c = ldexp(1.0, f);
+        h = x->hi * c;
+        l = x->lo * c;
+        r = x->rad * c;
+    }
+    else
+    {
+        h = ldexp(x->hi, f);
+        l = ldexp(x->lo, f);
+        r = ldexp(x->rad, f);
+    }
+
+    /* account for underflow */
+    if (f < 0 && ((x->hi != 0.0 && fabs(h) < ARB_DD_SMALL) ||
+            (x->rad != 0.0 && r < ARB_DD_SMALL)))
+        r = _arb_dd_up(r);
+
+    z->hi = h;
+    z->lo = l;
+    z->rad = r;
+}
+
+/* elementary functions */
+
+/* log(2) = ARB_DD_LOG2_1 + ARB_DD_LOG2_2 + ARB_DD_LOG2_3 + eps,
+   where |eps| <= ARB_DD_LOG2_ERR */
+#define ARB_DD_LOG2_1 0.6931471805599453
+#define ARB_DD_LOG2_2 2.3190468138462996e-17
+#define ARB_DD_LOG2_3 5.707708438416212e-34
+#define ARB_DD_LOG2_ERR 3.582432210601812e-50
+
+/* z = z - n log(2) for an integer n with |n| < 2^53; the products
+   with the first two parts of log(2) are exact */
+ARB_DD_INLINE void
+_arb_dd_submul_log2(arb_dd_t z, double n)
+{
+    double ph, pl;
+
+    _arb_dd_two_prod(&ph, &pl, n, ARB_DD_LOG2_1);
+    _arb_dd_add(z, z, -ph, -pl, 0.0);
+    _arb_dd_two_prod(&ph, &pl, n, ARB_DD_LOG2_2);
+    _arb_dd_add(z, z, -ph, -pl, 0.0);
+    ph = n * ARB_DD_LOG2_3;
+    _arb_dd_add(z, z, -ph, 0.0, _arb_dd_up(fabs(ph) * 2.220446049250313e-16
+        + fabs(n) * ARB_DD_LOG2_ERR));
+}
+
+void arb_dd_exp(arb_dd_t res, const arb_dd_t x);
+
+void arb_dd_log(arb_dd_t res, const arb_dd_t x);
+
+void arb_dd_sin_cos(arb_dd_t res_sin, arb_dd_t res_cos, const arb_dd_t x);
+
+int arb_dd_exp_arf(arb_t res, const arf_t x, slong prec);
+
+int arb_dd_log_arf(arb_t res, const arf_t x, slong prec);
+
+int arb_dd_sin_cos_arf(arb_t res_sin, arb_t res_cos, const arf_t x, slong prec);
+
+/* tables */
+
+#define ARB_DD_EXP_TAB_BITS 6
+#define ARB_DD_EXP_FINE_TAB_BITS 12
+#define ARB_DD_SIN_COS_TAB_BITS 5
+
+extern const arb_dd_struct arb_dd_exp_tab[];
+extern const arb_dd_struct arb_dd_exp_fine_tab[];
+extern const arb_dd_struct arb_dd_sin_tab[];
+extern const arb_dd_struct arb_dd_cos_tab[];
+extern const arb_dd_struct arb_dd_inv_fac_tab[];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
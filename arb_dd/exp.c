@@ -0,0 +1,140 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+#define INV_LOG2 1.4426950408889634
+
+/* error bound for _arb_dd_exp_taylor, including the 2^-118 bound for
+   the tail of the Taylor series after the s^7 term */
+#define EXP_SERIES_ERR 7.888609052210118e-31   /* 2^-100 */
+
+/*
+    Sets z to an approximation of exp(s), |s| <= 2^-13 (1 + 2^-10), by
+    evaluating the Taylor polynomial of degree 7. The terms of degree 4
+    and higher are smaller than 2^-56 and only need double precision.
+    Each double-double operation has relative error at most 2^-102, and
+    the intermediate values are bounded by 1.001 and damped by |s| in
+    each step, so the total error is bounded by EXP_SERIES_ERR.
+*/
+static void
+_arb_dd_exp_taylor(double * zh, double * zl, double sh, double sl)
+{
+    const arb_dd_struct * c = arb_dd_inv_fac_tab;
+    double h, l;
+    slong k;
+
+    h = c[7].hi;
+    for (k = 6; k >= 4; k--)
+        h = h * sh + c[k].hi;
+
+    l = 0.0;
+    for (k = 3; k >= 0; k--)
+    {
+        _arb_dd_mul_mid(&h, &l, h, l, sh, sl);
+        _arb_dd_add_mid(&h, &l, h, l, c[k].hi, c[k].lo);
+    }
+
+    *zh = h;
+    *zl = l;
+}
+
+void
+arb_dd_exp(arb_dd_t res, const arb_dd_t x)
+{
+    arb_dd_t t, u, s;
+    double n, j, k, xr;
+
+    if (!ARB_DD_IS_FINITE(x->hi) || !ARB_DD_IS_FINITE(x->lo))
+    {
+        arb_dd_indeterminate(res);
+        return;
+    }
+
+    xr = x->rad;
+
+    if (!(fabs(x->hi) <= 700.0) || !(xr <= 1.0))
+    {
+        arb_dd_zero_pm_inf(res);
+        return;
+    }
+
+    /* t = x - n log(2) */
+    n = floor(x->hi * INV_LOG2 + 0.5);
+
+    t->hi = x->hi;
+    t->lo = x->lo;
+    t->rad = 0.0;
+
+    if (n != 0.0)
+        _arb_dd_submul_log2(t, n);
+
+    /* s = t - j/64 - k/4096, |s| <= 1/8192 */
+    j = floor(t->hi * 64.0 + 0.5);
+    _arb_dd_add(s, t, -j * 0.015625, 0.0, 0.0);
+    k = floor(s->hi * 4096.0 + 0.5);
+    _arb_dd_add(s, s, -k * 0.000244140625, 0.0, 0.0);
+
+    if (!(arb_dd_abs_bound(s) <= 0.0001221) || !(fabs(j) <= 32.0)
+        || !(fabs(k) <= 32.0))
+    {
+        arb_dd_zero_pm_inf(res);
+        return;
+    }
+
+    /* exp(s), where |exp(s') - exp(s)| <= exp(0.0002) |s' - s| */
+    _arb_dd_exp_taylor(&u->hi, &u->lo, s->hi, s->lo);
+    u->rad = _arb_dd_up(EXP_SERIES_ERR + 1.001 * s->rad);
+
+    arb_dd_mul(u, u, arb_dd_exp_fine_tab + (slong) k + 32);
+    arb_dd_mul(u, u, arb_dd_exp_tab + (slong) j + 32);
+    arb_dd_mul_2exp_si(u, u, (slong) n);
+
+    /* exp(m + e) - exp(m) = exp(m) (exp(e) - 1) where
+       |exp(e) - 1| <= |e| + |e|^2 when |e| <= 1 */
+    if (xr != 0.0)
+        u->rad = _arb_dd_up(u->rad + (fabs(u->hi) + u->rad) * (xr + xr * xr));
+
+    arb_dd_set(res, u);
+}
+
+int
+arb_dd_exp_arf(arb_t res, const arf_t x, slong prec)
+{
+    arb_dd_t t;
+
+    if (!arb_dd_set_arf(t, x) || !(fabs(t->hi) < 512.0))
+        return 0;
+
+    arb_dd_exp(t, t);
+
+    if (!arb_dd_is_accurate(t, prec + 2))
+        return 0;
+
+    arb_dd_get_arb(res, t);
+    arb_set_round(res, res, prec);
+    return 1;
+}
+
@@ -0,0 +1,186 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+/* Balls containing exp(j/64) for -32 <= j <= 32 */
+const arb_dd_struct arb_dd_exp_tab[] =
+{
+    { 0.6065306597126334, -6.593178415491414e-19, 3.053967292073551e-35 }, /* exp(-32/64) */
+    { 0.6160821277906783, -4.790177517910084e-17, 9.833695159843067e-34 }, /* exp(-31/64) */
+    { 0.6257840096045911, -7.658883125910196e-18, 5.168513557178208e-34 }, /* exp(-30/64) */
+    { 0.635638673826052, -1.4420373617975653e-17, 5.9365432676000686e-34 }, /* exp(-29/64) */
+    { 0.645648526427892, -1.8153089476490168e-17, 5.33191626574319e-34 }, /* exp(-28/64) */
+    { 0.6558160112715016, -2.2954950495149666e-17, 2.8669194995228026e-34 }, /* exp(-27/64) */
+    { 0.6661436107034878, -4.620916718484541e-17, 1.625503836286583e-33 }, /* exp(-26/64) */
+    { 0.676633846161729, -1.01268391978119e-17, 3.1807693262152713e-34 }, /* exp(-25/64) */
+    { 0.6872892787909722, -3.7088003061371396e-17, 4.749089002318163e-34 }, /* exp(-24/64) */
+    { 0.6981125100681258, 4.379112262891346e-17, 2.5364274968568583e-33 }, /* exp(-23/64) */
+    { 0.7091061824373984, -1.2868055655346304e-17, 1.7780833442076942e-34 }, /* exp(-22/64) */
+    { 0.7202729799554398, -3.7374088280484695e-17, 2.1806014761367955e-33 }, /* exp(-21/64) */
+    { 0.7316156289466418, 8.35576468031604e-18, 6.780551377519811e-34 }, /* exp(-20/64) */
+    { 0.7431368986687583, -9.001102395673582e-19, 2.0316501636821806e-35 }, /* exp(-19/64) */
+    { 0.7548396019890073, -9.844076038651084e-18, 4.476527722112891e-34 }, /* exp(-18/64) */
+    { 0.76672659607082, 2.5682592802096574e-17, 1.4178154205953231e-33 }, /* exp(-17/64) */
+    { 0.7788007830714049, -1.0231869534531498e-17, 1.8335765467182516e-34 }, /* exp(-16/64) */
+    { 0.791065110850296, 5.426586044764942e-17, 2.4572146116974986e-33 }, /* exp(-15/64) */
+    { 0.8035225736890608, -3.661886830920417e-17, 1.2166976048255993e-33 }, /* exp(-14/64) */
+    { 0.8161762130223398, 6.554697808700811e-18, 2.977141164523471e-34 }, /* exp(-13/64) */
+    { 0.8290291181804004, -2.7604408719539223e-17, 3.15882249464708e-34 }, /* exp(-12/64) */
+    { 0.8420844271433824, -3.8967887440685524e-17, 2.333928978699431e-33 }, /* exp(-11/64) */
+    { 0.8553453273074225, 1.7204900005057594e-17, 1.0513555263060363e-33 }, /* exp(-10/64) */
+    { 0.8688150562628432, 6.146598011714697e-19, 3.8259337705781556e-35 }, /* exp(-9/64) */
+    { 0.8824969025845955, -5.224526916735663e-17, 5.213707115313011e-34 }, /* exp(-8/64) */
+    { 0.8963942066351505, -4.7460497709066285e-17, 2.755939345268658e-34 }, /* exp(-7/64) */
+    { 0.9105103613800342, -3.325048324577564e-17, 1.422484707811548e-33 }, /* exp(-6/64) */
+    { 0.9248488132162048, 1.0614261758612887e-17, 1.349635424834003e-34 }, /* exp(-5/64) */
+    { 0.9394130628134758, -2.152447043447057e-17, 7.000344186939159e-34 }, /* exp(-4/64) */
+    { 0.9542066659691884, -3.392457164103672e-17, 1.2555577262884802e-33 }, /* exp(-3/64) */
+    { 0.9692332344763441, -4.801151707083219e-17, 2.3871678416867618e-33 }, /* exp(-2/64) */
+    { 0.9844964370054085, -4.7493026566356186e-17, 2.086276411986373e-33 }, /* exp(-1/64) */
+    { 1.0, 0.0, 0.0 }, /* exp(0/64) */
+    { 1.0157477085866857, 2.0530467874932267e-17, 3.0448408725961768e-34 }, /* exp(1/64) */
+    { 1.0317434074991028, -8.944417741043132e-17, 2.4252054925794776e-33 }, /* exp(2/64) */
+    { 1.0479910020166328, -5.327900898877614e-17, 1.8045303343583146e-33 }, /* exp(3/64) */
+    { 1.0644944589178593, 1.0872888143211957e-16, 1.8607185935682512e-33 }, /* exp(4/64) */
+    { 1.0812578074490395, 6.013904942011385e-17, 5.463352120164751e-33 }, /* exp(5/64) */
+    { 1.0982851403078258, 9.070644949793751e-17, 4.095487249346991e-33 }, /* exp(6/64) */
+    { 1.1155806146424807, 5.298211318168963e-17, 1.1576236721048352e-33 }, /* exp(7/64) */
+    { 1.1331484530668263, -5.370737708558031e-18, 8.632104155326338e-35 }, /* exp(8/64) */
+    { 1.1509929446911764, 3.7613173622701076e-17, 2.704685570576179e-33 }, /* exp(9/64) */
+    { 1.1691184461695043, 6.945488167320411e-17, 4.669698459118414e-34 }, /* exp(10/64) */
+    { 1.1875293827631006, 6.415816207759217e-19, 3.026043088660038e-35 }, /* exp(11/64) */
+    { 1.2062302494209807, 3.9295715071105525e-17, 8.811653612357679e-34 }, /* exp(12/64) */
+    { 1.2252256118773075, 8.279379001181868e-17, 1.4364108971496473e-33 }, /* exp(13/64) */
+    { 1.2445201077660952, -7.440512295261056e-17, 3.339412946744743e-33 }, /* exp(14/64) */
+    { 1.2641184477534664, -1.541497933603795e-17, 7.5236314083306e-34 }, /* exp(15/64) */
+    { 1.2840254166877414, 8.968972781793724e-17, 3.2251225505891206e-34 }, /* exp(16/64) */
+    { 1.3042458747676378, 1.7093578107981658e-17, 1.2760937158674666e-33 }, /* exp(17/64) */
+    { 1.3247847587288655, 9.422682377542367e-17, 6.1075359070655605e-33 }, /* exp(18/64) */
+    { 1.3456470830494105, 3.415854209639032e-17, 3.135233509017301e-34 }, /* exp(19/64) */
+    { 1.3668379411737963, 5.1449446596411544e-17, 7.73200851956176e-34 }, /* exp(20/64) */
+    { 1.3883625067566268, 6.691963657219203e-17, 7.416787010746411e-34 }, /* exp(21/64) */
+    { 1.4102260349257107, -4.1758810273684196e-17, 1.4047178753790298e-33 }, /* exp(22/64) */
+    { 1.4324338635650782, -6.53862212642198e-17, 2.88626368112739e-33 }, /* exp(23/64) */
+    { 1.4549914146182013, 8.517923078996071e-17, 5.388261942639437e-33 }, /* exp(24/64) */
+    { 1.4779041954117385, -2.493763123963775e-17, 1.3474648605901795e-33 }, /* exp(25/64) */
+    { 1.5011778000001228, -4.5384955300459954e-17, 2.2824009403890355e-33 }, /* exp(26/64) */
+    { 1.5248179105313266, 5.66961782226858e-17, 5.03687921602169e-33 }, /* exp(27/64) */
+    { 1.5488302986341331, -3.110014802562223e-17, 2.879916854711363e-33 }, /* exp(28/64) */
+    { 1.573220826827253, -6.314292058750392e-17, 1.9176870680778442e-33 }, /* exp(29/64) */
+    { 1.5979954499506333, 1.6864630310268093e-17, 3.0982083691506167e-35 }, /* exp(30/64) */
+    { 1.6231602166193055, 6.968741123163187e-17, 3.684994378472143e-34 }, /* exp(31/64) */
+    { 1.6487212707001282, -4.731568479435833e-17, 2.3158591640901675e-33 }  /* exp(32/64) */
+};
+
+/* Balls containing exp(j/4096) for -32 <= j <= 32 */
+const arb_dd_struct arb_dd_exp_fine_tab[] =
+{
+    { 0.9922179382602435, -2.8192701381719798e-18, 2.5153935575334165e-35 }, /* exp(-32/4096) */
+    { 0.992460208540632, 5.2349685517298156e-17, 2.2168299946290703e-33 }, /* exp(-31/4096) */
+    { 0.9927025379762591, -1.1332967698138714e-17, 6.073852604031986e-34 }, /* exp(-30/4096) */
+    { 0.9929449265815685, -1.3372085289746382e-17, 4.460565785249342e-34 }, /* exp(-29/4096) */
+    { 0.9931873743710079, -2.1242885804601564e-17, 5.728142439808152e-34 }, /* exp(-28/4096) */
+    { 0.9934298813590282, -1.6462906121824057e-17, 8.340190753728454e-34 }, /* exp(-27/4096) */
+    { 0.993672447560084, -4.752956328599456e-18, 1.1064229458260546e-34 }, /* exp(-26/4096) */
+    { 0.9939150729886334, -1.5175561818075888e-17, 1.0201351950520898e-33 }, /* exp(-25/4096) */
+    { 0.9941577576591378, 1.1749107442218152e-17, 2.5396614930027117e-35 }, /* exp(-24/4096) */
+    { 0.9944005015860626, 2.86061067273757e-18, 1.1424356473800083e-34 }, /* exp(-23/4096) */
+    { 0.9946433047838764, -2.473496963594638e-17, 1.1236436571821503e-33 }, /* exp(-22/4096) */
+    { 0.9948861672670513, 3.719737195505255e-17, 2.4752849418407812e-33 }, /* exp(-21/4096) */
+    { 0.9951290890500631, -5.5205035766428365e-17, 5.561069495239844e-34 }, /* exp(-20/4096) */
+    { 0.995372070147391, -8.86130008886124e-18, 2.671273174702635e-34 }, /* exp(-19/4096) */
+    { 0.9956151105735179, 7.915345010289539e-18, 5.463108077063463e-34 }, /* exp(-18/4096) */
+    { 0.9958582103429301, 3.2414595916403756e-17, 2.8237128673768955e-33 }, /* exp(-17/4096) */
+    { 0.9961013694701175, -2.467437495486145e-17, 1.5516297911063402e-34 }, /* exp(-16/4096) */
+    { 0.9963445879695735, -4.53323478853409e-17, 2.493874226893034e-33 }, /* exp(-15/4096) */
+    { 0.996587865855795, -3.6413088476042827e-17, 2.5801988387585064e-33 }, /* exp(-14/4096) */
+    { 0.9968312031432824, -1.7756959486094782e-17, 2.2661089694781384e-34 }, /* exp(-13/4096) */
+    { 0.99707459984654, -2.132662415002894e-17, 1.4297066940563438e-33 }, /* exp(-12/4096) */
+    { 0.9973180559800752, 2.067976400314077e-17, 6.753973003375812e-34 }, /* exp(-11/4096) */
+    { 0.9975615715583991, 5.464867503051566e-17, 1.627074953954673e-33 }, /* exp(-10/4096) */
+    { 0.9978051465960265, 1.7438434982218657e-17, 3.7537437146335824e-34 }, /* exp(-9/4096) */
+    { 0.9980487811074755, -5.173333050138318e-17, 1.7247241556738073e-33 }, /* exp(-8/4096) */
+    { 0.9982924751072678, -1.0424343813089038e-17, 1.2411296239375877e-34 }, /* exp(-7/4096) */
+    { 0.9985362286099287, 5.483098090363991e-17, 1.0690442122117058e-33 }, /* exp(-6/4096) */
+    { 0.9987800416299872, 5.1431917694816366e-17, 2.0033186339203132e-33 }, /* exp(-5/4096) */
+    { 0.9990239141819757, -7.400282329795416e-18, 5.921674316165547e-34 }, /* exp(-4/4096) */
+    { 0.9992678462804299, -1.756193136643271e-18, 4.1970000621682097e-35 }, /* exp(-3/4096) */
+    { 0.9995118379398894, -3.723871179599398e-17, 2.665187920985401e-33 }, /* exp(-2/4096) */
+    { 0.9997558891748972, -7.227720384831839e-21, 6.267978440864785e-37 }, /* exp(-1/4096) */
+    { 1.0, 0.0, 0.0 }, /* exp(0/4096) */
+    { 1.0002441704297478, 7.402209661694593e-17, 5.947752301371098e-33 }, /* exp(1/4096) */
+    { 1.0004884004786945, 2.3131528773102296e-19, 5.893065392499042e-36 }, /* exp(2/4096) */
+    { 1.000732690161397, 1.756621947076926e-18, 1.2313419276537334e-34 }, /* exp(3/4096) */
+    { 1.0009770394924165, 8.141755997634129e-17, 3.556700104817155e-33 }, /* exp(4/4096) */
+    { 1.0012214484863171, 2.2592141509467e-17, 1.4123193714512094e-33 }, /* exp(5/4096) */
+    { 1.0014659171576668, 5.621876542741835e-17, 1.7733876448683635e-33 }, /* exp(6/4096) */
+    { 1.001710445521037, -2.651388715746562e-17, 7.54818819448522e-34 }, /* exp(7/4096) */
+    { 1.0019550335910028, 1.4880094000024225e-17, 9.215511546063375e-34 }, /* exp(8/4096) */
+    { 1.0021996813821428, -1.7125832152127843e-17, 1.2464586293860595e-33 }, /* exp(9/4096) */
+    { 1.002444388909039, -9.106789179759738e-17, 5.404536270467884e-33 }, /* exp(10/4096) */
+    { 1.0026891561862772, 5.4377167310985766e-17, 1.3820661811182813e-35 }, /* exp(11/4096) */
+    { 1.0029339832284467, 2.3083031938658462e-17, 1.0706989701019663e-33 }, /* exp(12/4096) */
+    { 1.0031788700501403, 9.461104098091774e-17, 1.6145049819034363e-33 }, /* exp(13/4096) */
+    { 1.0034238166659546, -1.071876436961704e-16, 4.260719622525933e-33 }, /* exp(14/4096) */
+    { 1.003668823090489, -5.898979001092021e-17, 3.5769026786794727e-34 }, /* exp(15/4096) */
+    { 1.0039138893383475, 1.0855789505997833e-16, 4.2502827138797204e-33 }, /* exp(16/4096) */
+    { 1.004159015424137, 5.579841301600701e-17, 1.1971752590266495e-33 }, /* exp(17/4096) */
+    { 1.0044042013624686, -9.893106117245821e-17, 5.187708753863937e-33 }, /* exp(18/4096) */
+    { 1.0046494471679557, -4.729211825117775e-19, 5.505396543261638e-36 }, /* exp(19/4096) */
+    { 1.0048947528552166, 5.584352640676866e-17, 1.3177350531563333e-33 }, /* exp(20/4096) */
+    { 1.0051401184388726, 1.3251769950925915e-17, 3.0142054184521912e-34 }, /* exp(21/4096) */
+    { 1.0053855439335486, 5.441959361940035e-17, 1.5000535728661409e-33 }, /* exp(22/4096) */
+    { 1.0056310293538733, -6.381302370554274e-17, 2.4184134530514213e-33 }, /* exp(23/4096) */
+    { 1.0058765747144782, 1.0066104271706714e-16, 6.095524524517405e-33 }, /* exp(24/4096) */
+    { 1.0061221800299998, -1.0026863649394781e-16, 5.717542339298597e-33 }, /* exp(25/4096) */
+    { 1.0063678453150764, 3.8432961703484573e-17, 1.785333003385794e-33 }, /* exp(26/4096) */
+    { 1.0066135705843515, -8.871638095298236e-17, 1.2582361419122194e-33 }, /* exp(27/4096) */
+    { 1.006859355852471, 4.564730857259921e-17, 1.188470493697222e-33 }, /* exp(28/4096) */
+    { 1.007105201134085, 1.0420574182324249e-16, 2.017172350012258e-33 }, /* exp(29/4096) */
+    { 1.0073511064438474, -3.945401833046727e-18, 3.488227623249262e-34 }, /* exp(30/4096) */
+    { 1.0075970717964147, 9.9621547625297e-17, 6.0508968636333235e-34 }, /* exp(31/4096) */
+    { 1.007843097206448, -6.872774751042842e-17, 4.5039699786824517e-33 }  /* exp(32/4096) */
+};
+
+/* Balls containing 1/k! for 0 <= k <= 13 */
+const arb_dd_struct arb_dd_inv_fac_tab[] =
+{
+    { 1.0, 0.0, 0.0 }, /* 1/0! */
+    { 1.0, 0.0, 0.0 }, /* 1/1! */
+    { 0.5, 0.0, 0.0 }, /* 1/2! */
+    { 0.16666666666666666, 9.25185853854297e-18, 5.1358131850326295e-34 }, /* 1/3! */
+    { 0.041666666666666664, 2.3129646346357427e-18, 1.2839532962581574e-34 }, /* 1/4! */
+    { 0.008333333333333333, 1.1564823173178714e-19, 1.604941620322697e-36 }, /* 1/5! */
+    { 0.001388888888888889, -5.300543954373577e-20, 1.738686755349588e-36 }, /* 1/6! */
+    { 0.0001984126984126984, 1.7209558293420705e-22, 1.492691239139413e-40 }, /* 1/7! */
+    { 2.48015873015873e-05, 2.1511947866775882e-23, 1.8658640489242661e-41 }, /* 1/8! */
+    { 2.7557319223985893e-06, -1.858393274046472e-22, 8.491754604881993e-39 }, /* 1/9! */
+    { 2.755731922398589e-07, 2.3767714622250297e-23, 3.263188903340883e-40 }, /* 1/10! */
+    { 2.505210838544172e-08, -1.448814070935912e-24, 2.0426735146714455e-41 }, /* 1/11! */
+    { 2.08767569878681e-09, -1.20734505911326e-25, 1.7022279288928713e-42 }, /* 1/12! */
+    { 1.6059043836821613e-10, 1.2585294588752098e-26, 5.31334602762985e-43 }  /* 1/13! */
+};
+
@@ -0,0 +1,54 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+void
+arb_dd_get_arb(arb_t res, const arb_dd_t x)
+{
+    if (!ARB_DD_IS_FINITE(x->hi) || !ARB_DD_IS_FINITE(x->lo))
+    {
+        arb_indeterminate(res);
+        return;
+    }
+
+    /* hi + lo has at most 106 bits, so this is exact */
+    arf_set_d(arb_midref(res), x->hi);
+
+    if (x->lo != 0.0)
+    {
+        arf_t t;
+        arf_init(t);
+        arf_set_d(t, x->lo);
+        arf_add(arb_midref(res), arb_midref(res), t, ARF_PREC_EXACT, ARF_RND_DOWN);
+        arf_clear(t);
+    }
+
+    if (x->rad <= 1e300)
+        mag_set_d(arb_radref(res), x->rad);
+    else
+        mag_inf(arb_radref(res));
+}
+
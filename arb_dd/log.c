@@ -0,0 +1,151 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+/* 1/3 = THIRD_HI + THIRD_LO + eps, |eps| <= THIRD_ERR */
+#define THIRD_HI 0.3333333333333333
+#define THIRD_LO 1.850371707708594e-17
+#define THIRD_ERR 1.0271626370065259e-33
+
+/* bound, relative to |t|, for the rounding errors in _arb_dd_log1p_taylor
+   and the 2^-103 bound for the tail of the series after the t^8 term */
+#define LOG1P_SERIES_ERR 1.5777218104420236e-30   /* 2^-99 */
+
+/*
+    Sets z to an approximation of log(1 + t), |t| <= 2^-13 (1 + 2^-10),
+    by evaluating the Taylor polynomial of degree 8. The terms of degree
+    5 and higher are smaller than 2^-66 and only need double precision.
+*/
+static void
+_arb_dd_log1p_taylor(double * zh, double * zl, double th, double tl)
+{
+    double h, l;
+
+    h = -0.125;
+    h = h * th + 0.14285714285714285;
+    h = h * th - 0.16666666666666666;
+    h = h * th + 0.2;
+
+    l = 0.0;
+    _arb_dd_mul_mid(&h, &l, h, l, th, tl);
+    _arb_dd_add_mid(&h, &l, h, l, -0.25, 0.0);
+    _arb_dd_mul_mid(&h, &l, h, l, th, tl);
+    _arb_dd_add_mid(&h, &l, h, l, THIRD_HI, THIRD_LO);
+    _arb_dd_mul_mid(&h, &l, h, l, th, tl);
+    _arb_dd_add_mid(&h, &l, h, l, -0.5, 0.0);
+    _arb_dd_mul_mid(&h, &l, h, l, th, tl);
+    _arb_dd_add_mid(&h, &l, h, l, 1.0, 0.0);
+    _arb_dd_mul_mid(&h, &l, h, l, th, tl);
+
+    *zh = h;
+    *zl = l;
+}
+
+void
+arb_dd_log(arb_dd_t res, const arb_dd_t x)
+{
+    arb_dd_t u, t, p;
+    double y, m, j, T;
+    int e;
+
+    /* require x > 0 */
+    if (!ARB_DD_IS_FINITE(x->hi) || !ARB_DD_IS_FINITE(x->lo) ||
+        !(x->hi * ARB_DD_DOWN - x->rad * ARB_DD_UP > 0.0))
+    {
+        arb_dd_indeterminate(res);
+        return;
+    }
+
+    /* x = 2^e u with 1/sqrt(2) <= u < sqrt(2) */
+    frexp(x->hi, &e);
+    if (ldexp(x->hi, -e) < 0.7071067811865476)
+        e--;
+    arb_dd_mul_2exp_si(u, x, -e);
+
+    /*
+        With y = j/64 + k/4096 close to log(u) and t = u exp(-y) - 1,
+        we have log(u) = y + log(1 + t), where exp(-y) is read off the
+        tables for exp. The ball for t also accounts for the radius of x.
+        The libm value used to choose y is not trusted: if it is too poor
+        (or the radius of x is too large), we give up.
+    */
+    m = floor(log(u->hi) * 4096.0 + 0.5);
+    j = floor(m * 0.015625 + 0.5);
+    m -= 64.0 * j;
+
+    if (!(fabs(j) <= 32.0) || !(fabs(m) <= 32.0))
+    {
+        arb_dd_zero_pm_inf(res);
+        return;
+    }
+
+    y = j * 0.015625 + m * 0.000244140625;
+
+    arb_dd_mul(t, u, arb_dd_exp_tab + 32 - (slong) j);
+    arb_dd_mul(t, t, arb_dd_exp_fine_tab + 32 - (slong) m);
+    _arb_dd_add(t, t, -1.0, 0.0, 0.0);
+
+    T = arb_dd_abs_bound(t);
+
+    if (!(T <= 0.0001221))
+    {
+        arb_dd_zero_pm_inf(res);
+        return;
+    }
+
+    /* |log(1 + t') - log(1 + t)| <= |t' - t| / (1 - T) */
+    _arb_dd_log1p_taylor(&p->hi, &p->lo, t->hi, t->lo);
+    p->rad = _arb_dd_up(LOG1P_SERIES_ERR * T + 1.001 * t->rad);
+
+    _arb_dd_add(p, p, y, 0.0, 0.0);
+
+    /* log(x) = log(u) + e log(2) */
+    if (e != 0)
+        _arb_dd_submul_log2(p, -e);
+
+    arb_dd_set(res, p);
+}
+
+int
+arb_dd_log_arf(arb_t res, const arf_t x, slong prec)
+{
+    arb_dd_t t;
+
+    /* close to 1, the relative accuracy would suffer */
+    if (!arb_dd_set_arf(t, x) || !(t->hi > 0.0) ||
+        fabs(t->hi - 1.0) < 0.00390625)
+        return 0;
+
+    arb_dd_log(t, t);
+
+    if (!arb_dd_is_accurate(t, prec + 2))
+        return 0;
+
+    arb_dd_get_arb(res, t);
+    arb_set_round(res, res, prec);
+    return 1;
+}
+
@@ -0,0 +1,58 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+int
+arb_dd_set_arb(arb_dd_t res, const arb_t x)
+{
+    const mag_struct * r = arb_radref(x);
+    double t;
+
+    if (!arb_dd_set_arf(res, arb_midref(x)))
+        return 0;
+
+    if (mag_is_zero(r))
+        return 1;
+
+    if (mag_is_inf(r) || mag_cmp_2exp_si(r, 1000) > 0)
+    {
+        arb_dd_indeterminate(res);
+        return 0;
+    }
+
+    if (mag_cmp_2exp_si(r, -900) < 0)
+        t = ARB_DD_SMALL;
+    else
+        t = ldexp((double) MAG_MAN(r), MAG_EXP(r) - MAG_BITS);
+
+    if (res->rad == 0.0)
+        res->rad = t;
+    else
+        res->rad = _arb_dd_up(res->rad + t);
+
+    return 1;
+}
+
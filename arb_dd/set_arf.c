@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+int
+arb_dd_set_arf(arb_dd_t res, const arf_t x)
+{
+    double a, b;
+    slong exp;
+    int inexact;
+
+    if (arf_is_special(x))
+    {
+        if (arf_is_zero(x))
+        {
+            arb_dd_zero(res);
+            return 1;
+        }
+
+        arb_dd_indeterminate(res);
+        return 0;
+    }
+
+    /* keep clear of overflow, and make sure that the low part
+       of the midpoint is never subnormal */
+    if (COEFF_IS_MPZ(ARF_EXP(x)) || ARF_EXP(x) < -800 || ARF_EXP(x) > 1000)
+    {
+        arb_dd_indeterminate(res);
+        return 0;
+    }
+
+    exp = ARF_EXP(x);
+
+#if FLINT_BITS == 64
+    {
+        mp_srcptr xp;
+        mp_size_t xn;
+        mp_limb_t hi, lo;
+
+        ARF_GET_MPN_READONLY(xp, xn, x);
+
+        hi = xp[xn - 1];
+        lo = (xn >= 2) ? xp[xn - 2] : 0;
+
+        /* the top 53 bits and the next 53 bits of the mantissa */
+        a = (double) (hi >> 11);
+        b = (double) (((hi & ((UWORD(1) << 11) - 1)) << 42) | (lo >> 22));
+        inexact = (xn > 2) || ((lo & ((UWORD(1) << 22) - 1)) != 0);
+
+        a = ldexp(a, exp - 53);
+        b = ldexp(b, exp - 106);
+
+        if (ARF_SGNBIT(x))
+        {
+            a = -a;
+            b = -b;
+        }
+    }
+#else
+    {
+        arf_t t, u;
+
+        arf_init(t);
+        arf_init(u);
+
+        a = arf_get_d(x, ARF_RND_DOWN);
+        arf_set_d(t, a);
+        inexact = arf_sub(u, x, t, 53, ARF_RND_DOWN);
+        b = arf_get_d(u, ARF_RND_DOWN);
+
+        arf_clear(t);
+        arf_clear(u);
+    }
+#endif
+
+    _arb_dd_fast_two_sum(&res->hi, &res->lo, a, b);
+
+    /* the discarded bits are bounded by 2^(exp-106) */
+    res->rad = inexact ? ldexp(1.0, exp - 106) : 0.0;
+
+    return 1;
+}
+
@@ -0,0 +1,235 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+/* pi/2 = PI2_1 + PI2_2 + PI2_3 + eps, |eps| <= PI2_ERR */
+#define PI2_1 1.5707963267948966
+#define PI2_2 6.123233995736766e-17
+#define PI2_3 -1.4973849048591698e-33
+#define PI2_ERR 5.562271104316827e-50
+#define TWO_OVER_PI 0.6366197723675814
+
+/* error bounds for _arb_dd_sin_cos_taylor (relative for the sine),
+   including the bounds 2^-104 |s| and 2^-110 for the tails of the
+   Taylor series after the s^11 and s^12 terms */
+#define SIN_SERIES_ERR 1.5777218104420236e-30   /* 2^-99 */
+#define COS_SERIES_ERR 1.5777218104420236e-30   /* 2^-99 */
+
+/*
+    Sets s and c to approximations of sin(x) and cos(x), |x| <= 0.016, by
+    evaluating the Taylor polynomials of degree 11 and 12 in w = x^2. The
+    terms with w^4 and higher powers of w only need double precision.
+    The error analysis is the same as for _arb_dd_exp_taylor, with the
+    intermediate values bounded by 1 and damped by |w| <= 2^-11 in
+    each step.
+*/
+static void
+_arb_dd_sin_cos_taylor(double * sh, double * sl, double * ch, double * cl,
+    double xh, double xl)
+{
+    const arb_dd_struct * c = arb_dd_inv_fac_tab;
+    double wh, wl, h, l;
+    slong k;
+
+    _arb_dd_mul_mid(&wh, &wl, xh, xl, xh, xl);
+
+    /* sin(x) / x = sum (-1)^k w^k / (2k+1)! */
+    h = -c[11].hi * wh + c[9].hi;
+    l = 0.0;
+    for (k = 3; k >= 0; k--)
+    {
+        _arb_dd_mul_mid(&h, &l, h, l, wh, wl);
+        if (k % 2 == 0)
+            _arb_dd_add_mid(&h, &l, h, l, c[2 * k + 1].hi, c[2 * k + 1].lo);
+        else
+            _arb_dd_add_mid(&h, &l, h, l, -c[2 * k + 1].hi, -c[2 * k + 1].lo);
+    }
+    _arb_dd_mul_mid(sh, sl, h, l, xh, xl);
+
+    /* cos(x) = sum (-1)^k w^k / (2k)! */
+    h = (c[12].hi * wh - c[10].hi) * wh + c[8].hi;
+    l = 0.0;
+    for (k = 3; k >= 0; k--)
+    {
+        _arb_dd_mul_mid(&h, &l, h, l, wh, wl);
+        if (k % 2 == 0)
+            _arb_dd_add_mid(&h, &l, h, l, c[2 * k].hi, c[2 * k].lo);
+        else
+            _arb_dd_add_mid(&h, &l, h, l, -c[2 * k].hi, -c[2 * k].lo);
+    }
+    *ch = h;
+    *cl = l;
+}
+
+void
+arb_dd_sin_cos(arb_dd_t res_sin, arb_dd_t res_cos, const arb_dd_t x)
+{
+    arb_dd_t t, s, u, v, sa, ca;
+    double n, j, xr, ph, pl, S;
+    slong q;
+
+    if (!ARB_DD_IS_FINITE(x->hi) || !ARB_DD_IS_FINITE(x->lo))
+    {
+        if (res_sin != NULL)
+            arb_dd_indeterminate(res_sin);
+        if (res_cos != NULL)
+            arb_dd_indeterminate(res_cos);
+        return;
+    }
+
+    xr = x->rad;
+
+    if (!(fabs(x->hi) <= 1048576.0) || !(xr <= 1.0))
+    {
+        arb_dd_zero(u);
+        u->rad = 1.0;
+        if (res_sin != NULL)
+            arb_dd_set(res_sin, u);
+        if (res_cos != NULL)
+            arb_dd_set(res_cos, u);
+        return;
+    }
+
+    /* t = x - n pi/2, the products with the first two parts of
+       pi/2 being exact */
+    n = floor(x->hi * TWO_OVER_PI + 0.5);
+
+    t->hi = x->hi;
+    t->lo = x->lo;
+    t->rad = 0.0;
+
+    if (n != 0.0)
+    {
+        _arb_dd_two_prod(&ph, &pl, n, PI2_1);
+        _arb_dd_add(t, t, -ph, -pl, 0.0);
+        _arb_dd_two_prod(&ph, &pl, n, PI2_2);
+        _arb_dd_add(t, t, -ph, -pl, 0.0);
+        ph = n * PI2_3;
+        _arb_dd_add(t, t, -ph, 0.0,
+            _arb_dd_up(fabs(ph) * 2.220446049250313e-16 + fabs(n) * PI2_ERR));
+    }
+
+    /* s = t - j/32, |s| <= 1/64 */
+    j = floor(t->hi * 32.0 + 0.5);
+    _arb_dd_add(s, t, -j * 0.03125, 0.0, 0.0);
+
+    S = arb_dd_abs_bound(s);
+
+    if (!(S <= 0.016) || !(fabs(j) <= 32.0))
+    {
+        arb_dd_zero(u);
+        u->rad = 1.0;
+        if (res_sin != NULL)
+            arb_dd_set(res_sin, u);
+        if (res_cos != NULL)
+            arb_dd_set(res_cos, u);
+        return;
+    }
+
+    /* sin(s) and cos(s), which are 1-Lipschitz */
+    _arb_dd_sin_cos_taylor(&u->hi, &u->lo, &v->hi, &v->lo, s->hi, s->lo);
+    u->rad = _arb_dd_up(SIN_SERIES_ERR * S + s->rad);
+    v->rad = _arb_dd_up(COS_SERIES_ERR + s->rad);
+
+    /* sin(a + s) = sin(a) cos(s) + cos(a) sin(s),
+       cos(a + s) = cos(a) cos(s) - sin(a) sin(s) */
+    if (j != 0.0)
+    {
+        if (j > 0.0)
+            arb_dd_set(sa, arb_dd_sin_tab + (slong) j);
+        else
+            arb_dd_neg(sa, arb_dd_sin_tab + (slong) (-j));
+
+        arb_dd_set(ca, arb_dd_cos_tab + (slong) fabs(j));
+
+        arb_dd_mul(s, sa, v);
+        arb_dd_addmul(s, ca, u);
+        arb_dd_mul(t, ca, v);
+        arb_dd_submul(t, sa, u);
+
+        arb_dd_set(u, s);
+        arb_dd_set(v, t);
+    }
+
+    /* sin(x) and cos(x) from sin(t) and cos(t) */
+    q = ((slong) n) & 3;
+
+    if (q == 1 || q == 3)
+    {
+        arb_dd_set(s, u);
+        arb_dd_set(u, v);
+        arb_dd_set(v, s);
+    }
+
+    if (q == 2 || q == 3)
+        arb_dd_neg(u, u);
+
+    if (q == 1 || q == 2)
+        arb_dd_neg(v, v);
+
+    /* |sin(m + e) - sin(m)|, |cos(m + e) - cos(m)| <= |e| */
+    if (xr != 0.0)
+    {
+        arb_dd_add_error_d(u, xr);
+        arb_dd_add_error_d(v, xr);
+    }
+
+    if (res_sin != NULL)
+        arb_dd_set(res_sin, u);
+    if (res_cos != NULL)
+        arb_dd_set(res_cos, v);
+}
+
+int
+arb_dd_sin_cos_arf(arb_t res_sin, arb_t res_cos, const arf_t x, slong prec)
+{
+    arb_dd_t t, s, c;
+
+    if (!arb_dd_set_arf(t, x) || !(fabs(t->hi) < 1024.0))
+        return 0;
+
+    arb_dd_sin_cos(s, c, t);
+
+    /* near a zero of sin or cos, the relative accuracy suffers */
+    if ((res_sin != NULL && !arb_dd_is_accurate(s, prec + 2)) ||
+        (res_cos != NULL && !arb_dd_is_accurate(c, prec + 2)))
+        return 0;
+
+    if (res_sin != NULL)
+    {
+        arb_dd_get_arb(res_sin, s);
+        arb_set_round(res_sin, res_sin, prec);
+    }
+
+    if (res_cos != NULL)
+    {
+        arb_dd_get_arb(res_cos, c);
+        arb_set_round(res_cos, res_cos, prec);
+    }
+
+    return 1;
+}
+
@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+/* Balls containing sin(j/32) for 0 <= j <= 32 */
+const arb_dd_struct arb_dd_sin_tab[] =
+{
+    { 0.0, 0.0, 0.0 }, /* sin(0/32) */
+    { 0.03124491398532608, -1.562781562225433e-18, 5.291457368560251e-35 }, /* sin(1/32) */
+    { 0.0624593178423802, -2.040259504585711e-18, 1.3632507567037225e-34 }, /* sin(2/32) */
+    { 0.09361273123551289, 1.4628632005878733e-18, 1.2060268575284523e-35 }, /* sin(3/32) */
+    { 0.12467473338522769, -2.925947496057858e-18, 5.753016495554525e-36 }, /* sin(4/32) */
+    { 0.15561499277355603, 8.886053372342288e-18, 3.191401993903333e-35 }, /* sin(5/32) */
+    { 0.18640329676226988, 2.3493796901281573e-18, 1.1860601847613397e-34 }, /* sin(6/32) */
+    { 0.21700958109501015, 1.1170071073364376e-17, 3.4809773184262135e-35 }, /* sin(7/32) */
+    { 0.24740395925452294, -7.53102495590706e-18, 5.610697290224163e-34 }, /* sin(8/32) */
+    { 0.2775567516463363, 1.7674070262791822e-17, 1.5393854695550988e-33 }, /* sin(9/32) */
+    { 0.30743851458038085, 1.1004366442765296e-19, 1.0651517242320465e-35 }, /* sin(10/32) */
+    { 0.33702006902225307, 1.0312279860787216e-17, 1.6658832144392665e-34 }, /* sin(11/32) */
+    { 0.36627252908604757, -9.938814562106524e-18, 4.048628322309409e-34 }, /* sin(12/32) */
+    { 0.39516733024093426, -1.9613487871414228e-17, 7.779475780687775e-34 }, /* sin(13/32) */
+    { 0.42367625720393803, -2.331800700068871e-17, 7.08175283506348e-34 }, /* sin(14/32) */
+    { 0.4517714714916838, -8.234073942098903e-18, 6.008697091132814e-35 }, /* sin(15/32) */
+    { 0.479425538604203, -5.103969860556013e-18, 3.7134329111577535e-34 }, /* sin(16/32) */
+    { 0.5066114548142574, -3.269413423618168e-17, 2.149619308808387e-33 }, /* sin(17/32) */
+    { 0.5333026735360201, 5.129318115032044e-17, 4.472109569648539e-34 }, /* sin(18/32) */
+    { 0.5594731312473669, 1.575565514488728e-17, 7.702430551343702e-34 }, /* sin(19/32) */
+    { 0.5850972729404622, -5.4883972461161805e-17, 1.9081134867594303e-33 }, /* sin(20/32) */
+    { 0.6101500770757914, -1.479826990758988e-17, 1.2384702400587094e-33 }, /* sin(21/32) */
+    { 0.6346070800152693, -3.4568582392624965e-17, 2.3067856740952835e-33 }, /* sin(22/32) */
+    { 0.6584443999105676, -3.7736386700306717e-17, 4.36041191688379e-34 }, /* sin(23/32) */
+    { 0.6816387600233341, 4.410467313197903e-17, 1.2378037481286456e-34 }, /* sin(24/32) */
+    { 0.7041675114545337, -3.94095700584825e-17, 1.9935005043325585e-33 }, /* sin(25/32) */
+    { 0.7260086552607126, -1.573621815339587e-17, 2.0334045862984174e-34 }, /* sin(26/32) */
+    { 0.7471408639355942, 2.937498788028212e-17, 2.4439626676935194e-33 }, /* sin(27/32) */
+    { 0.7675435022360271, -3.573483123546625e-17, 6.850386634984781e-34 }, /* sin(28/32) */
+    { 0.7871966473319489, -4.500814036448646e-19, 2.2739277635732e-35 }, /* sin(29/32) */
+    { 0.806081108260693, -1.8173616480548578e-17, 1.3232774779110626e-33 }, /* sin(30/32) */
+    { 0.8241784446666367, 4.0387672285061345e-17, 2.040708785123394e-33 }, /* sin(31/32) */
+    { 0.8414709848078965, 1.776845092935536e-18, 1.4730549161871724e-34 }  /* sin(32/32) */
+};
+
+/* Balls containing cos(j/32) for 0 <= j <= 32 */
+const arb_dd_struct arb_dd_cos_tab[] =
+{
+    { 1.0, 0.0, 0.0 }, /* cos(0/32) */
+    { 0.9995117584851364, -3.418806487972947e-17, 2.2270643952717987e-33 }, /* cos(1/32) */
+    { 0.9980475107000991, 3.3232291674141346e-17, 4.015282074516496e-34 }, /* cos(2/32) */
+    { 0.9956086864580017, 3.312922430932991e-17, 2.149273176593155e-33 }, /* cos(3/32) */
+    { 0.992197667229329, 4.754870575189364e-17, 2.782896497307132e-33 }, /* cos(4/32) */
+    { 0.9878177838164719, 4.91917302237681e-17, 1.1066886001966504e-33 }, /* cos(5/32) */
+    { 0.9824733131012553, -3.919920375420088e-17, 2.0908543032787937e-34 }, /* cos(6/32) */
+    { 0.9761694738686353, -7.850690609285027e-18, 2.2136579186367175e-34 }, /* cos(7/32) */
+    { 0.9689124217106447, 5.071436662403936e-17, 2.124059285887094e-33 }, /* cos(8/32) */
+    { 0.9607092430155619, -2.807827063516729e-17, 4.756123705144932e-34 }, /* cos(9/32) */
+    { 0.9515679480481722, -3.8614834675674123e-17, 2.2211878623313026e-33 }, /* cos(10/32) */
+    { 0.9414974631278811, -4.8523830236797095e-18, 3.8197889521141553e-34 }, /* cos(11/32) */
+    { 0.9305076219123143, 4.488760003328074e-18, 6.88423883641885e-35 }, /* cos(12/32) */
+    { 0.9186091557949183, -4.0564150104514996e-17, 1.7998726188900467e-33 }, /* cos(13/32) */
+    { 0.9058136834259364, 4.2864666490805214e-17, 6.138740140767649e-34 }, /* cos(14/32) */
+    { 0.8921336993669944, 2.3160655211380166e-17, 1.359228154831322e-33 }, /* cos(15/32) */
+    { 0.8775825618903728, -4.2623149864279997e-17, 9.919134682117543e-34 }, /* cos(16/32) */
+    { 0.8621744799348805, 4.4132427578105805e-18, 1.5543731260697024e-34 }, /* cos(17/32) */
+    { 0.8459244992310679, 1.549506647350329e-17, 1.0394559746987808e-33 }, /* cos(18/32) */
+    { 0.8288484876093257, 1.1163935406617444e-17, 4.671742352867593e-34 }, /* cos(19/32) */
+    { 0.8109631195052179, -3.091333486122179e-17, 2.974143284514536e-33 }, /* cos(20/32) */
+    { 0.7922858596771786, -2.9049779312834576e-17, 1.2766064196745508e-33 }, /* cos(21/32) */
+    { 0.7728349461524715, 4.231014921891023e-17, 3.4568846594332603e-34 }, /* cos(22/32) */
+    { 0.7526293724180665, -1.2970993013150526e-17, 6.369447846697662e-34 }, /* cos(23/32) */
+    { 0.7316888688738209, -1.0475824306512768e-17, 3.0371505541297855e-34 }, /* cos(24/32) */
+    { 0.7100338835660797, 1.505272211891291e-17, 1.100223791889349e-33 }, /* cos(25/32) */
+    { 0.6876855622205048, 3.5430696752823923e-17, 1.2605829626655643e-33 }, /* cos(26/32) */
+    { 0.6646657275936333, -5.2874573286772266e-17, 1.8707944657341924e-33 }, /* cos(27/32) */
+    { 0.6409968581633251, 5.198410459670848e-17, 2.758038685047506e-33 }, /* cos(28/32) */
+    { 0.616702066178912, 5.146871675146304e-17, 1.4169332916176972e-33 }, /* cos(29/32) */
+    { 0.5918050750924775, 2.15859860798048e-17, 1.0802977406792544e-33 }, /* cos(30/32) */
+    { 0.5663301963933087, -2.886651669472867e-17, 6.835232894971941e-34 }, /* cos(31/32) */
+    { 0.5403023058681398, -4.760954612604417e-17, 2.746584769589095e-33 }  /* cos(32/32) */
+};
+
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("exp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        arb_t x, y, z, w;
+        arb_dd_t a, b;
+        fmpq_t q;
+        slong prec;
+
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+        arb_init(w);
+        fmpq_init(q);
+
+        arb_randtest(x, state, 1 + n_randint(state, 120), 4);
+
+        if (n_randint(state, 2))
+            mag_zero(arb_radref(x));
+
+        if (!arb_dd_set_arb(a, x))
+            goto cleanup;
+
+        arb_dd_get_arb(x, a);
+        arb_dd_exp(b, a);
+        arb_dd_get_arb(y, b);
+
+        arb_get_rand_fmpq(q, state, x, 1 + n_randint(state, 200));
+        arb_set_fmpq(w, q, 400);
+        arb_exp(z, w, 400);
+
+        if (!arb_overlaps(y, z))
+        {
+            flint_printf("FAIL: overlap\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        if (arb_is_exact(x) && arf_cmpabs_2exp_si(arb_midref(x), 8) < 0 &&
+            arb_rel_accuracy_bits(y) < 95)
+        {
+            flint_printf("FAIL: accuracy\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        /* the entry point used by arb functions at low precision */
+        prec = 2 + n_randint(state, 100);
+
+        if (arb_dd_exp_arf(w, arb_midref(x), prec))
+        {
+            arb_set_arf(z, arb_midref(x));
+            arb_exp(z, z, 400);
+
+            if (!arb_overlaps(w, z) || arb_rel_accuracy_bits(w) < prec - 2)
+            {
+                flint_printf("FAIL: exp_arf\n\n");
+                flint_printf("prec = %wd\n\n", prec);
+                flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+                flint_printf("w = "); arb_printd(w, 50); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z, 50); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+cleanup:
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+        arb_clear(w);
+        fmpq_clear(q);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("set_arb....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        arb_t x, y;
+        arb_dd_t t;
+        int success;
+
+        arb_init(x);
+        arb_init(y);
+
+        if (n_randint(state, 2))
+            arb_randtest_exact(x, state, 1 + n_randint(state, 200), 12);
+        else
+            arb_randtest_special(x, state, 1 + n_randint(state, 200), 12);
+
+        success = arb_dd_set_arb(t, x);
+
+        if (success)
+        {
+            arb_dd_get_arb(y, t);
+
+            if (!arb_contains(y, x))
+            {
+                flint_printf("FAIL: containment\n\n");
+                flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+                abort();
+            }
+
+            /* exact conversion of midpoints with at most 106 bits */
+            if (arb_is_exact(x) && arf_bits(arb_midref(x)) <= ARB_DD_PREC
+                && !arb_equal(y, x))
+            {
+                flint_printf("FAIL: exact roundtrip\n\n");
+                flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+                abort();
+            }
+        }
+        else if (arb_is_finite(x) && arf_cmpabs_2exp_si(arb_midref(x), 100) < 0
+            && arf_cmpabs_2exp_si(arb_midref(x), -100) > 0
+            && mag_cmp_2exp_si(arb_radref(x), 100) < 0)
+        {
+            flint_printf("FAIL: conversion failed\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_clear(x);
+        arb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_dd.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("sub....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        arb_t x, y, z;
+        arb_dd_t a, b, c;
+        fmpq_t p, q, r;
+
+        arb_init(x);
+        arb_init(y);
+        arb_init(z);
+        fmpq_init(p);
+        fmpq_init(q);
+        fmpq_init(r);
+
+        arb_randtest(x, state, 1 + n_randint(state, 120), 6);
+        arb_randtest(y, state, 1 + n_randint(state, 120), 6);
+
+        if (n_randint(state, 2))
+            mag_zero(arb_radref(x));
+        if (n_randint(state, 2))
+            mag_zero(arb_radref(y));
+
+        if (!arb_dd_set_arb(a, x) || !arb_dd_set_arb(b, y))
+            goto cleanup;
+
+        /* the balls actually represented */
+        arb_dd_get_arb(x, a);
+        arb_dd_get_arb(y, b);
+
+        arb_dd_sub(c, a, b);
+        arb_dd_get_arb(z, c);
+
+        arb_get_rand_fmpq(p, state, x, 1 + n_randint(state, 200));
+        arb_get_rand_fmpq(q, state, y, 1 + n_randint(state, 200));
+        fmpq_sub(r, p, q);
+
+        if (!arb_contains_fmpq(z, r))
+        {
+            flint_printf("FAIL: containment\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        if (arb_is_exact(x) && arb_is_exact(y) && !arb_is_zero(z)
+            && arb_rel_accuracy_bits(z) < 100)
+        {
+            flint_printf("FAIL: accuracy\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+            flint_printf("z = "); arb_printd(z, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        /* aliasing */
+        arb_dd_sub(a, a, b);
+
+        if (a->hi != c->hi || a->lo != c->lo || a->rad != c->rad)
+        {
+            flint_printf("FAIL: aliasing\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+            abort();
+        }
+
+cleanup:
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(z);
+        fmpq_clear(p);
+        fmpq_clear(q);
+        fmpq_clear(r);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
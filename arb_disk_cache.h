@@ -0,0 +1,89 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#ifndef ARB_DISK_CACHE_H
+#define ARB_DISK_CACHE_H
+
+#include <stddef.h>
+#include "flint.h"
+#include "fmpq.h"
+#include "arb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARB_DISK_CACHE_MAGIC UWORD(0x41524243)
+#define ARB_DISK_CACHE_VERSION 1
+#define ARB_DISK_CACHE_HEADER_WORDS 6
+
+#define ARB_DISK_CACHE_KIND_ARB 1
+#define ARB_DISK_CACHE_KIND_FMPQ_VEC 2
+
+/* constants computed to less precision are neither loaded nor stored */
+#define ARB_DISK_CACHE_MIN_PREC 4096
+
+void arb_disk_cache_set_dir(const char * dir);
+
+int arb_disk_cache_enabled(void);
+
+int arb_disk_cache_load_arb(arb_t x, slong * prec, const char * name);
+
+void arb_disk_cache_save_arb(const arb_t x, slong prec, const char * name);
+
+slong arb_disk_cache_load_fmpq_vec(fmpq * vec, slong len, const char * name);
+
+void arb_disk_cache_save_fmpq_vec(const fmpq * vec, slong len, const char * name);
+
+/* internal functions */
+
+typedef struct
+{
+    void * addr;
+    size_t size;
+    const ulong * data;
+    slong len;
+}
+arb_disk_cache_map_struct;
+
+typedef arb_disk_cache_map_struct arb_disk_cache_map_t[1];
+
+char * _arb_disk_cache_path(const char * name);
+
+ulong _arb_disk_cache_checksum(const ulong * data, slong len);
+
+int _arb_disk_cache_map(arb_disk_cache_map_t map, const char * name, ulong kind);
+
+void _arb_disk_cache_unmap(arb_disk_cache_map_t map);
+
+int _arb_disk_cache_write(const char * name, ulong kind,
+    const ulong * data, slong len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,123 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_disk_cache.h"
+
+/*
+    Payload: prec, sign, exponent and number of limbs n of the midpoint,
+    the n limbs, and the mantissa and exponent of the radius.
+*/
+
+int
+arb_disk_cache_load_arb(arb_t x, slong * prec, const char * name)
+{
+    arb_disk_cache_map_t map;
+    const ulong * d;
+    slong n, exp, radexp;
+    ulong radman;
+    int ok;
+
+    if (!_arb_disk_cache_map(map, name, ARB_DISK_CACHE_KIND_ARB))
+        return 0;
+
+    d = map->data;
+    ok = 0;
+    n = exp = 0;
+
+    if (map->len >= 6 && d[3] == (ulong) (map->len - 6))
+    {
+        n = d[3];
+        exp = (slong) d[2];
+        radman = d[4 + n];
+        radexp = (slong) d[5 + n];
+
+        ok = ((slong) d[0] > 0) && (d[1] <= 1)
+            && (n == 0 || d[3 + n] != 0)
+            && (radman >> MAG_BITS) == 0
+            && FLINT_ABS(exp) < COEFF_MAX / 4
+            && FLINT_ABS(radexp) < COEFF_MAX / 4;
+    }
+
+    if (ok)
+    {
+        *prec = (slong) d[0];
+
+        if (n == 0)
+        {
+            arf_zero(arb_midref(x));
+        }
+        else
+        {
+            arf_set_mpn(arb_midref(x), d + 4, n, d[1]);
+            arf_mul_2exp_si(arb_midref(x), arb_midref(x), exp - n * FLINT_BITS);
+        }
+
+        mag_set_ui_2exp_si(arb_radref(x), radman, radexp - MAG_BITS);
+    }
+
+    _arb_disk_cache_unmap(map);
+
+    return ok;
+}
+
+void
+arb_disk_cache_save_arb(const arb_t x, slong prec, const char * name)
+{
+    mp_srcptr xp;
+    mp_size_t xn;
+    ulong * d;
+
+    if (!arb_disk_cache_enabled())
+        return;
+
+    if (!arb_is_finite(x) || COEFF_IS_MPZ(MAG_EXP(arb_radref(x))) ||
+        (!arf_is_zero(arb_midref(x)) && COEFF_IS_MPZ(ARF_EXP(arb_midref(x)))))
+        return;
+
+    if (arf_is_zero(arb_midref(x)))
+    {
+        xp = NULL;
+        xn = 0;
+    }
+    else
+    {
+        ARF_GET_MPN_READONLY(xp, xn, arb_midref(x));
+    }
+
+    d = flint_malloc((6 + xn) * sizeof(ulong));
+
+    d[0] = prec;
+    d[1] = (xn == 0) ? 0 : ARF_SGNBIT(arb_midref(x));
+    d[2] = (xn == 0) ? 0 : (ulong) ARF_EXP(arb_midref(x));
+    d[3] = xn;
+    if (xn != 0)
+        flint_mpn_copyi(d + 4, xp, xn);
+    d[4 + xn] = MAG_MAN(arb_radref(x));
+    d[5 + xn] = (ulong) MAG_EXP(arb_radref(x));
+
+    _arb_disk_cache_write(name, ARB_DISK_CACHE_KIND_ARB, d, 6 + xn);
+
+    flint_free(d);
+}
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "arb_disk_cache.h"
+
+/*
+    The cache directory is set with arb_disk_cache_set_dir(); if this
+    has not been called, the environment variable ARB_DISK_CACHE_DIR
+    is read the first time the cache is accessed. Without either,
+    the disk cache is disabled.
+*/
+
+static pthread_mutex_t arb_disk_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+static char * arb_disk_cache_dir = NULL;
+static int arb_disk_cache_initialized = 0;
+
+/* must be called with arb_disk_cache_mutex held */
+static void
+_arb_disk_cache_set_dir(const char * dir)
+{
+    free(arb_disk_cache_dir);
+    arb_disk_cache_dir = NULL;
+
+    if (dir != NULL && dir[0] != '\0')
+    {
+        arb_disk_cache_dir = malloc(strlen(dir) + 1);
+        if (arb_disk_cache_dir != NULL)
+            strcpy(arb_disk_cache_dir, dir);
+    }
+
+    arb_disk_cache_initialized = 1;
+}
+
+void
+arb_disk_cache_set_dir(const char * dir)
+{
+    pthread_mutex_lock(&arb_disk_cache_mutex);
+    _arb_disk_cache_set_dir(dir);
+    pthread_mutex_unlock(&arb_disk_cache_mutex);
+}
+
+int
+arb_disk_cache_enabled(void)
+{
+    int enabled;
+
+    pthread_mutex_lock(&arb_disk_cache_mutex);
+    if (!arb_disk_cache_initialized)
+        _arb_disk_cache_set_dir(getenv("ARB_DISK_CACHE_DIR"));
+    enabled = (arb_disk_cache_dir != NULL);
+    pthread_mutex_unlock(&arb_disk_cache_mutex);
+
+    return enabled;
+}
+
+char *
+_arb_disk_cache_path(const char * name)
+{
+    char * path;
+
+    pthread_mutex_lock(&arb_disk_cache_mutex);
+
+    if (!arb_disk_cache_initialized)
+        _arb_disk_cache_set_dir(getenv("ARB_DISK_CACHE_DIR"));
+
+    if (arb_disk_cache_dir == NULL)
+    {
+        path = NULL;
+    }
+    else
+    {
+        path = flint_malloc(strlen(arb_disk_cache_dir) + strlen(name) + 16);
+        strcpy(path, arb_disk_cache_dir);
+        strcat(path, "/");
+        strcat(path, name);
+        strcat(path, ".arbcache");
+    }
+
+    pthread_mutex_unlock(&arb_disk_cache_mutex);
+
+    return path;
+}
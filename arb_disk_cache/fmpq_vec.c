@@ -0,0 +1,174 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_disk_cache.h"
+
+/*
+    Payload: the length, followed by the numerator and denominator of
+    each entry. An integer is stored as its sign, its number of limbs n,
+    and n limbs of its absolute value.
+*/
+
+static slong
+_fmpz_num_words(const fmpz_t x)
+{
+    if (!COEFF_IS_MPZ(*x))
+        return 2 + (*x != 0);
+    else
+        return 2 + FLINT_ABS(COEFF_TO_PTR(*x)->_mp_size);
+}
+
+static slong
+_fmpz_put_words(ulong * d, const fmpz_t x)
+{
+    if (!COEFF_IS_MPZ(*x))
+    {
+        d[0] = (*x < 0);
+        d[1] = (*x != 0);
+        if (*x != 0)
+            d[2] = FLINT_ABS(*x);
+        return 2 + (*x != 0);
+    }
+    else
+    {
+        __mpz_struct * z = COEFF_TO_PTR(*x);
+        slong n = FLINT_ABS(z->_mp_size);
+
+        d[0] = (z->_mp_size < 0);
+        d[1] = n;
+        flint_mpn_copyi(d + 2, z->_mp_d, n);
+        return 2 + n;
+    }
+}
+
+/* returns the number of words read, or 0 if the data is invalid */
+static slong
+_fmpz_get_words(fmpz_t x, const ulong * d, slong len)
+{
+    slong n;
+
+    if (len < 2 || d[0] > 1 || d[1] > (ulong) (len - 2))
+        return 0;
+
+    n = d[1];
+
+    if (n == 0)
+    {
+        fmpz_zero(x);
+    }
+    else if (d[1 + n] == 0)
+    {
+        return 0;
+    }
+    else if (n == 1 && d[2] <= COEFF_MAX)
+    {
+        fmpz_set_ui(x, d[2]);
+    }
+    else
+    {
+        __mpz_struct * z = _fmpz_promote(x);
+        mpz_realloc2(z, n * FLINT_BITS);
+        flint_mpn_copyi(z->_mp_d, d + 2, n);
+        z->_mp_size = n;
+        _fmpz_demote_val(x);
+    }
+
+    if (d[0])
+        fmpz_neg(x, x);
+
+    return 2 + n;
+}
+
+slong
+arb_disk_cache_load_fmpq_vec(fmpq * vec, slong len, const char * name)
+{
+    arb_disk_cache_map_t map;
+    const ulong * d;
+    slong i, n, pos, k;
+
+    if (!_arb_disk_cache_map(map, name, ARB_DISK_CACHE_KIND_FMPQ_VEC))
+        return 0;
+
+    d = map->data;
+
+    if (map->len < 1)
+    {
+        _arb_disk_cache_unmap(map);
+        return 0;
+    }
+
+    n = FLINT_MIN(len, (slong) FLINT_MIN(d[0], (ulong) WORD_MAX));
+    pos = 1;
+
+    for (i = 0; i < n; i++)
+    {
+        k = _fmpz_get_words(fmpq_numref(vec + i), d + pos, map->len - pos);
+        if (k == 0)
+            break;
+        pos += k;
+
+        k = _fmpz_get_words(fmpq_denref(vec + i), d + pos, map->len - pos);
+        if (k == 0 || fmpz_sgn(fmpq_denref(vec + i)) <= 0)
+            break;
+        pos += k;
+    }
+
+    /* leave a partially read entry in a valid state */
+    if (i < n)
+        fmpq_zero(vec + i);
+
+    _arb_disk_cache_unmap(map);
+
+    return i;
+}
+
+void
+arb_disk_cache_save_fmpq_vec(const fmpq * vec, slong len, const char * name)
+{
+    ulong * d;
+    slong i, size, pos;
+
+    if (!arb_disk_cache_enabled())
+        return;
+
+    size = 1;
+    for (i = 0; i < len; i++)
+        size += _fmpz_num_words(fmpq_numref(vec + i))
+              + _fmpz_num_words(fmpq_denref(vec + i));
+
+    d = flint_malloc(size * sizeof(ulong));
+
+    d[0] = len;
+    pos = 1;
+    for (i = 0; i < len; i++)
+    {
+        pos += _fmpz_put_words(d + pos, fmpq_numref(vec + i));
+        pos += _fmpz_put_words(d + pos, fmpq_denref(vec + i));
+    }
+
+    _arb_disk_cache_write(name, ARB_DISK_CACHE_KIND_FMPQ_VEC, d, size);
+
+    flint_free(d);
+}
@@ -0,0 +1,169 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "arb_disk_cache.h"
+
+/*
+    A cache file consists of ARB_DISK_CACHE_HEADER_WORDS words
+
+        magic, version, FLINT_BITS, kind, payload length, checksum
+
+    followed by the payload, all stored as native ulongs. Files written
+    on a machine with a different word size or byte order, by another
+    version of the format, or that are truncated or corrupted, are
+    rejected when they are mapped.
+*/
+
+ulong
+_arb_disk_cache_checksum(const ulong * data, slong len)
+{
+    ulong h;
+    slong i;
+
+    h = (ulong) len;
+
+    for (i = 0; i < len; i++)
+    {
+        h = (h << 7) | (h >> (FLINT_BITS - 7));
+        h = (h ^ data[i]) * UWORD(0x9e3779b1);
+    }
+
+    return h ^ (h >> (FLINT_BITS / 2));
+}
+
+int
+_arb_disk_cache_map(arb_disk_cache_map_t map, const char * name, ulong kind)
+{
+    char * path;
+    struct stat st;
+    const ulong * w;
+    void * addr;
+    slong len;
+    int fd;
+
+    path = _arb_disk_cache_path(name);
+
+    if (path == NULL)
+        return 0;
+
+    fd = open(path, O_RDONLY);
+    flint_free(path);
+
+    if (fd < 0)
+        return 0;
+
+    if (fstat(fd, &st) != 0 || st.st_size < 0 ||
+        (size_t) st.st_size < ARB_DISK_CACHE_HEADER_WORDS * sizeof(ulong))
+    {
+        close(fd);
+        return 0;
+    }
+
+    addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED)
+        return 0;
+
+    w = (const ulong *) addr;
+    len = (st.st_size / sizeof(ulong)) - ARB_DISK_CACHE_HEADER_WORDS;
+
+    if (w[0] != ARB_DISK_CACHE_MAGIC || w[1] != ARB_DISK_CACHE_VERSION ||
+        w[2] != FLINT_BITS || w[3] != kind || w[4] != (ulong) len ||
+        (size_t) st.st_size % sizeof(ulong) != 0 ||
+        w[5] != _arb_disk_cache_checksum(w + ARB_DISK_CACHE_HEADER_WORDS, len))
+    {
+        munmap(addr, st.st_size);
+        return 0;
+    }
+
+    map->addr = addr;
+    map->size = st.st_size;
+    map->data = w + ARB_DISK_CACHE_HEADER_WORDS;
+    map->len = len;
+
+    return 1;
+}
+
+void
+_arb_disk_cache_unmap(arb_disk_cache_map_t map)
+{
+    munmap(map->addr, map->size);
+}
+
+int
+_arb_disk_cache_write(const char * name, ulong kind, const ulong * data, slong len)
+{
+    char * path, * tmp;
+    ulong header[ARB_DISK_CACHE_HEADER_WORDS];
+    FILE * fp;
+    int ok;
+
+    path = _arb_disk_cache_path(name);
+
+    if (path == NULL)
+        return 0;
+
+    header[0] = ARB_DISK_CACHE_MAGIC;
+    header[1] = ARB_DISK_CACHE_VERSION;
+    header[2] = FLINT_BITS;
+    header[3] = kind;
+    header[4] = len;
+    header[5] = _arb_disk_cache_checksum(data, len);
+
+    /* write to a file private to this process and thread (the address
+       of the header identifies the thread) and rename it, so that
+       readers never see a partially written file */
+    tmp = flint_malloc(strlen(path) + 64);
+    flint_sprintf(tmp, "%s.%wu.%wu.tmp", path, (ulong) getpid(),
+        (ulong) (size_t) header);
+
+    ok = 0;
+    fp = fopen(tmp, "wb");
+
+    if (fp != NULL)
+    {
+        ok = (fwrite(header, sizeof(ulong), ARB_DISK_CACHE_HEADER_WORDS, fp)
+                == ARB_DISK_CACHE_HEADER_WORDS);
+        ok = ok && (fwrite(data, sizeof(ulong), len, fp) == (size_t) len);
+        ok = (fclose(fp) == 0) && ok;
+        ok = ok && (rename(tmp, path) == 0);
+
+        if (!ok)
+            remove(tmp);
+    }
+
+    flint_free(tmp);
+    flint_free(path);
+
+    return ok;
+}
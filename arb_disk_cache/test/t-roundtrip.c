@@ -0,0 +1,187 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <stdio.h>
+#include "arb_disk_cache.h"
+
+/* flips one bit in the payload of the file */
+static void
+corrupt(const char * name, flint_rand_t state)
+{
+    char * path;
+    FILE * fp;
+    long size, pos;
+    int c;
+
+    path = _arb_disk_cache_path(name);
+    fp = fopen(path, "r+b");
+    if (fp == NULL)
+    {
+        flint_printf("FAIL: cannot open %s\n", path);
+        abort();
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    pos = ARB_DISK_CACHE_HEADER_WORDS * sizeof(ulong);
+    pos += n_randint(state, size - pos);
+    fseek(fp, pos, SEEK_SET);
+    c = fgetc(fp);
+    fseek(fp, pos, SEEK_SET);
+    fputc(c ^ (1 << n_randint(state, 8)), fp);
+    fclose(fp);
+    flint_free(path);
+}
+
+static void
+remove_file(const char * name)
+{
+    char * path = _arb_disk_cache_path(name);
+    remove(path);
+    flint_free(path);
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+    const char * name = "t-roundtrip";
+
+    flint_printf("roundtrip....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    arb_disk_cache_set_dir(".");
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        arb_t x, y;
+        slong prec, prec2;
+
+        arb_init(x);
+        arb_init(y);
+
+        prec = 2 + n_randint(state, 5000);
+        arb_randtest(x, state, prec, 10);
+        arb_disk_cache_save_arb(x, prec, name);
+
+        if (!arb_disk_cache_load_arb(y, &prec2, name) ||
+            prec != prec2 || !arb_equal(x, y))
+        {
+            flint_printf("FAIL: arb\n\n");
+            flint_printf("x = "); arb_printd(x, 50); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        if (arb_is_finite(x))
+        {
+            corrupt(name, state);
+
+            if (arb_disk_cache_load_arb(y, &prec2, name))
+            {
+                flint_printf("FAIL: arb corruption not detected\n\n");
+                abort();
+            }
+        }
+
+        remove_file(name);
+
+        arb_clear(x);
+        arb_clear(y);
+    }
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        fmpq * a, * b;
+        slong i, len, len2, num;
+        int ok;
+
+        len = n_randint(state, 30);
+        len2 = n_randint(state, 30);
+        a = _fmpq_vec_init(len);
+        b = _fmpq_vec_init(len2);
+
+        for (i = 0; i < len; i++)
+            fmpq_randtest(a + i, state, 1 + n_randint(state, 500));
+
+        arb_disk_cache_save_fmpq_vec(a, len, name);
+        num = arb_disk_cache_load_fmpq_vec(b, len2, name);
+
+        ok = (num == FLINT_MIN(len, len2));
+        for (i = 0; i < num && ok; i++)
+            ok = fmpq_equal(a + i, b + i);
+
+        if (!ok)
+        {
+            flint_printf("FAIL: fmpq_vec\n\n");
+            flint_printf("len = %wd, len2 = %wd, num = %wd\n\n", len, len2, num);
+            abort();
+        }
+
+        if (len != 0 && len2 >= len)
+        {
+            corrupt(name, state);
+
+            num = arb_disk_cache_load_fmpq_vec(b, len2, name);
+
+            if (num != 0)
+            {
+                flint_printf("FAIL: fmpq_vec corruption not detected\n\n");
+                abort();
+            }
+        }
+
+        remove_file(name);
+
+        _fmpq_vec_clear(a, len);
+        _fmpq_vec_clear(b, len2);
+    }
+
+    /* disabled cache */
+    {
+        arb_t x;
+        slong prec;
+
+        arb_init(x);
+        arb_one(x);
+        arb_disk_cache_set_dir(NULL);
+        arb_disk_cache_save_arb(x, 100, name);
+
+        if (arb_disk_cache_enabled() || arb_disk_cache_load_arb(x, &prec, name))
+        {
+            flint_printf("FAIL: disabled\n\n");
+            abort();
+        }
+
+        arb_clear(x);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
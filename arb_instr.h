@@ -0,0 +1,137 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#ifndef ARB_INSTR_H
+#define ARB_INSTR_H
+
+#include <stdio.h>
+#include "flint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* events recorded by the library when built with ARB_INSTRUMENT */
+typedef enum
+{
+    ARB_INSTR_GAMMA_FMPQ,
+    ARB_INSTR_GAMMA_STIRLING,
+    ARB_INSTR_GAMMA_RISING,
+    ARB_INSTR_2F1_DIRECT,
+    ARB_INSTR_2F1_TRANSFORM,
+    ARB_INSTR_2F1_CORNER,
+    ARB_INSTR_U_ASYMP,
+    ARB_INSTR_U_1F1,
+    ARB_INSTR_PFQ_SUM_FORWARD,
+    ARB_INSTR_PFQ_SUM_RS,
+    ARB_INSTR_PFQ_SUM_BS,
+    ARB_INSTR_PFQ_SUM_FME,
+    ARB_INSTR_HYPGEOM_SUM,
+    ARB_INSTR_PREC_INCREASE,
+    ARB_INSTR_NUM
+}
+arb_instr_event_t;
+
+typedef struct
+{
+    ulong count;
+    ulong total;
+    double time;
+}
+arb_instr_counter_struct;
+
+extern int arb_instr_active;
+
+int arb_instr_available(void);
+
+void arb_instr_enable(int flag);
+
+int arb_instr_enabled(void);
+
+void arb_instr_reset(void);
+
+ulong arb_instr_count(arb_instr_event_t event);
+
+ulong arb_instr_total(arb_instr_event_t event);
+
+double arb_instr_time(arb_instr_event_t event);
+
+const char * arb_instr_event_name(arb_instr_event_t event);
+
+void arb_instr_fprint(FILE * file);
+
+void arb_instr_print(void);
+
+/* internal functions */
+
+void _arb_instr_count(arb_instr_event_t event, slong total);
+
+double _arb_instr_clock(void);
+
+void _arb_instr_stop(arb_instr_event_t event, double start, slong total);
+
+/*
+    ARB_INSTR_COUNT(event, total) records one occurrence of event, adding
+    total (for example a number of terms) to its running sum.
+    ARB_INSTR_TIME(event, total, stmt) additionally times stmt.
+    Both expand to (almost) nothing unless ARB_INSTRUMENT is defined.
+*/
+
+#ifdef ARB_INSTRUMENT
+
+#define ARB_INSTR_COUNT(event, total) \
+    do { \
+        if (arb_instr_active) \
+            _arb_instr_count(event, total); \
+    } while (0)
+
+#define ARB_INSTR_TIME(event, total, stmt) \
+    do { \
+        if (arb_instr_active) \
+        { \
+            double arb_instr_t0_ = _arb_instr_clock(); \
+            stmt; \
+            _arb_instr_stop(event, arb_instr_t0_, total); \
+        } \
+        else \
+        { \
+            stmt; \
+        } \
+    } while (0)
+
+#else
+
+#define ARB_INSTR_COUNT(event, total) do { } while (0)
+
+#define ARB_INSTR_TIME(event, total, stmt) do { stmt; } while (0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
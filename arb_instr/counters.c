@@ -0,0 +1,153 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+#include <string.h>
+#include "arb_instr.h"
+
+/* the switch is global; the counters are kept separately by each thread */
+int arb_instr_active = 0;
+
+FLINT_TLS_PREFIX arb_instr_counter_struct arb_instr_counters[ARB_INSTR_NUM];
+
+static const char * arb_instr_names[ARB_INSTR_NUM] =
+{
+    "gamma_fmpq",
+    "gamma_stirling",
+    "gamma_rising",
+    "2f1_direct",
+    "2f1_transform",
+    "2f1_corner",
+    "u_asymp",
+    "u_1f1",
+    "pfq_sum_forward",
+    "pfq_sum_rs",
+    "pfq_sum_bs",
+    "pfq_sum_fme",
+    "hypgeom_sum",
+    "prec_increase",
+};
+
+int
+arb_instr_available(void)
+{
+#ifdef ARB_INSTRUMENT
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void
+arb_instr_enable(int flag)
+{
+    arb_instr_active = (flag != 0);
+}
+
+int
+arb_instr_enabled(void)
+{
+    return arb_instr_active;
+}
+
+void
+arb_instr_reset(void)
+{
+    memset(arb_instr_counters, 0, sizeof(arb_instr_counters));
+}
+
+ulong
+arb_instr_count(arb_instr_event_t event)
+{
+    return arb_instr_counters[event].count;
+}
+
+ulong
+arb_instr_total(arb_instr_event_t event)
+{
+    return arb_instr_counters[event].total;
+}
+
+double
+arb_instr_time(arb_instr_event_t event)
+{
+    return arb_instr_counters[event].time;
+}
+
+const char *
+arb_instr_event_name(arb_instr_event_t event)
+{
+    return arb_instr_names[event];
+}
+
+void
+arb_instr_fprint(FILE * file)
+{
+    int i;
+
+    fprintf(file, "%-20s %12s %16s %12s\n", "event", "count", "total", "seconds");
+
+    for (i = 0; i < ARB_INSTR_NUM; i++)
+    {
+        if (arb_instr_counters[i].count != 0)
+            fprintf(file, "%-20s %12lu %16lu %12.6f\n", arb_instr_names[i],
+                (unsigned long) arb_instr_counters[i].count,
+                (unsigned long) arb_instr_counters[i].total,
+                arb_instr_counters[i].time);
+    }
+}
+
+void
+arb_instr_print(void)
+{
+    arb_instr_fprint(stdout);
+}
+
+void
+_arb_instr_count(arb_instr_event_t event, slong total)
+{
+    arb_instr_counters[event].count++;
+    arb_instr_counters[event].total += total;
+}
+
+/* processor time of the calling thread, matching the per-thread counters */
+double
+_arb_instr_clock(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+void
+_arb_instr_stop(arb_instr_event_t event, double start, slong total)
+{
+    arb_instr_counters[event].count++;
+    arb_instr_counters[event].total += total;
+    arb_instr_counters[event].time += _arb_instr_clock() - start;
+}
+
@@ -0,0 +1,135 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_instr.h"
+#include "arb.h"
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("counters....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        arb_t x, y;
+        acb_t a, b, c, z, r;
+        slong prec;
+        int i, enabled;
+
+        arb_init(x);
+        arb_init(y);
+        acb_init(a);
+        acb_init(b);
+        acb_init(c);
+        acb_init(z);
+        acb_init(r);
+
+        prec = 2 + n_randint(state, 500);
+        enabled = n_randint(state, 2);
+
+        /* a non-exact argument is never passed to arb_gamma_fmpq */
+        arb_randtest(x, state, 1 + n_randint(state, 500), 3);
+        mag_set_ui_2exp_si(arb_radref(x), 1, -prec - 10);
+        arf_abs(arb_midref(x), arb_midref(x));
+        arb_add_ui(x, x, 1, prec);
+
+        acb_set_d(a, 0.25);
+        acb_set_d(b, 0.5);
+        acb_set_d(c, 1.75);
+        acb_set_d_d(z, 0.125, 0.0625);
+
+        arb_instr_enable(enabled);
+        arb_instr_reset();
+
+        arb_gamma(y, x, prec);
+        acb_hypgeom_2f1(r, a, b, c, z, 0, prec);
+
+        arb_instr_enable(0);
+
+        if (arb_instr_enabled())
+        {
+            flint_printf("FAIL (enabled)\n\n");
+            abort();
+        }
+
+        if (enabled && arb_instr_available())
+        {
+            if (arb_instr_count(ARB_INSTR_GAMMA_STIRLING) != 1 ||
+                arb_instr_count(ARB_INSTR_GAMMA_FMPQ) != 0 ||
+                arb_instr_count(ARB_INSTR_2F1_DIRECT) != 1 ||
+                arb_instr_count(ARB_INSTR_2F1_CORNER) != 0 ||
+                arb_instr_time(ARB_INSTR_GAMMA_STIRLING) < 0.0)
+            {
+                flint_printf("FAIL (counts)\n\n");
+                flint_printf("prec = %wd\n\n", prec);
+                arb_instr_print();
+                abort();
+            }
+        }
+        else
+        {
+            for (i = 0; i < ARB_INSTR_NUM; i++)
+            {
+                if (arb_instr_count(i) != 0 || arb_instr_total(i) != 0 ||
+                    arb_instr_time(i) != 0.0)
+                {
+                    flint_printf("FAIL (disabled)\n\n");
+                    flint_printf("%s\n\n", arb_instr_event_name(i));
+                    abort();
+                }
+            }
+        }
+
+        arb_instr_reset();
+
+        for (i = 0; i < ARB_INSTR_NUM; i++)
+        {
+            if (arb_instr_count(i) != 0)
+            {
+                flint_printf("FAIL (reset)\n\n");
+                abort();
+            }
+        }
+
+        arb_clear(x);
+        arb_clear(y);
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(c);
+        acb_clear(z);
+        acb_clear(r);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
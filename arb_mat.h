@@ -144,6 +144,13 @@ void arb_mat_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, sl
 
 void arb_mat_mul_threaded(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec);
 
+void arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec);
+
+void _arb_mat_transpose_shallow(arb_ptr BT, const arb_mat_t B);
+
+void _arb_mat_mul_classical_block(arb_mat_t C, const arb_mat_t A, arb_srcptr BT,
+    slong r0, slong r1, slong c0, slong c1, slong prec);
+
 void arb_mat_sqr(arb_mat_t B, const arb_mat_t A, slong prec);
 
 void arb_mat_sqr_classical(arb_mat_t B, const arb_mat_t A, slong prec);
@@ -20,19 +20,36 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "arb_mat.h"
 
+/* use exact integer matrix multiplication for the midpoints when all
+   dimensions are at least arb_tune_get(ARB_TUNE_MAT_MUL_BLOCK, prec)
+   and the precision is at least this large */
+#define ARB_MAT_MUL_BLOCK_MIN_PREC 128
+
 void
 arb_mat_mul(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
 {
-    if (flint_get_num_threads() > 1 &&
+    slong n;
+
+    n = FLINT_MIN(arb_mat_nrows(A), arb_mat_ncols(A));
+    n = FLINT_MIN(n, arb_mat_ncols(B));
+
+    if (n >= arb_tune_get(ARB_TUNE_MAT_MUL_BLOCK, prec) &&
+        prec >= ARB_MAT_MUL_BLOCK_MIN_PREC)
+    {
+        arb_mat_mul_block(C, A, B, prec);
+    }
+    else if (flint_get_num_threads() > 1 &&
         ((double) arb_mat_nrows(A) *
          (double) arb_mat_nrows(B) *
          (double) arb_mat_ncols(B) *
-         (double) prec > 100000))
+         (double) prec >
+            (double) arb_tune_get(ARB_TUNE_MAT_MUL_THREADED_WORK, prec)))
     {
         arb_mat_mul_threaded(C, A, B, prec);
     }
@@ -41,4 +58,3 @@ arb_mat_mul(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
         arb_mat_mul_classical(C, A, B, prec);
     }
 }
-
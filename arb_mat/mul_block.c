@@ -0,0 +1,317 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <math.h>
+#include "arb_mat.h"
+
+/* nonzero magnitudes are rounded up to at least 2^DBL_CLAMP_EXP (relative
+   to the scaling exponent) when converted to doubles, so that products
+   of two scaled values never underflow */
+#define DBL_CLAMP_EXP -500
+
+/* vectors whose nonzero midpoints span a wider exponent range than this
+   (or than prec) are not handled; this also keeps the scaled midpoints
+   well above 2^DBL_CLAMP_EXP, so the radius bounds are not inflated */
+#define MAX_EXP_SPREAD 400
+
+/* upper bound for x * 2^(-e), where x is lagom and x <= 2^e */
+static double
+_mag_get_d_scaled(const mag_t x, slong e)
+{
+    slong d;
+
+    if (mag_is_zero(x))
+        return 0.0;
+
+    d = MAG_EXP(x) - e;
+
+    if (d < DBL_CLAMP_EXP)
+        return ldexp(1.0, DBL_CLAMP_EXP);
+
+    return ldexp((double) MAG_MAN(x), d - MAG_BITS);
+}
+
+/*
+    Given len vectors v_0, ..., v_{len-1} of length n (with entry k of
+    vector i at rows[i][k]), writes integers Z_{i,k} (Z_{k,i} if transpose
+    is set) and exponents shift[i] such that |v_{i,k} - Z 2^shift[i]| is
+    bounded by the radius of v_{i,k} plus the truncation error. Also writes
+    doubles Dmid, Drad with upper bounds for |mid(v_{i,k})| 2^(-emid[i])
+    and the total radius times 2^(-erad[i]), all at most 1.
+
+    Every midpoint keeps at least prec + FLINT_BITS bits relative to
+    its own magnitude, so the truncation error of a product is small
+    compared to the sum of the absolute values of the terms. Returns 0
+    (leaving the output partially written) if the nonzero midpoints of
+    some vector span more than min(prec, MAX_EXP_SPREAD) bits of exponent
+    range; a single shift cannot represent such a vector accurately.
+*/
+static int
+_arb_mat_mul_block_split(fmpz_mat_t Z, int transpose, slong * shift,
+    double * Dmid, double * Drad, slong * emid, slong * erad,
+    arb_ptr * rows, slong len, slong n, slong prec)
+{
+    slong i, k, top, bot, low, e, bits;
+    mag_ptr rad;
+    mag_t t;
+    fmpz * z;
+
+    rad = _mag_vec_init(n);
+    mag_init(t);
+
+    for (i = 0; i < len; i++)
+    {
+        arb_srcptr v = rows[i];
+
+        /* range of bits occupied by the midpoints in this vector */
+        top = WORD_MIN;
+        bot = WORD_MAX;
+        low = WORD_MAX;
+
+        for (k = 0; k < n; k++)
+        {
+            if (!arf_is_zero(arb_midref(v + k)))
+            {
+                e = ARF_EXP(arb_midref(v + k));
+                top = FLINT_MAX(top, e);
+                low = FLINT_MIN(low, e);
+                bot = FLINT_MIN(bot, e - ARF_SIZE(arb_midref(v + k)) * FLINT_BITS);
+            }
+        }
+
+        if (top == WORD_MIN)
+        {
+            top = 0;
+            bits = 0;
+        }
+        else if (top - low > FLINT_MIN(prec, MAX_EXP_SPREAD))
+        {
+            _mag_vec_clear(rad, n);
+            mag_clear(t);
+            return 0;
+        }
+        else
+        {
+            bits = FLINT_MIN(top - bot, top - low + prec + FLINT_BITS);
+        }
+
+        emid[i] = top;
+        shift[i] = top - bits;
+        erad[i] = WORD_MIN;
+
+        for (k = 0; k < n; k++)
+        {
+            z = transpose ? fmpz_mat_entry(Z, k, i) : fmpz_mat_entry(Z, i, k);
+
+            mag_set(rad + k, arb_radref(v + k));
+
+            if (arf_get_fmpz_fixed_si(z, arb_midref(v + k), shift[i]))
+                mag_fast_add_2exp_si(rad + k, rad + k, shift[i]);
+
+            if (!mag_is_zero(rad + k))
+                erad[i] = FLINT_MAX(erad[i], MAG_EXP(rad + k));
+
+            mag_fast_init_set_arf(t, arb_midref(v + k));
+            Dmid[i * n + k] = _mag_get_d_scaled(t, top);
+        }
+
+        if (erad[i] == WORD_MIN)
+            erad[i] = 0;
+
+        for (k = 0; k < n; k++)
+            Drad[i * n + k] = _mag_get_d_scaled(rad + k, erad[i]);
+    }
+
+    _mag_vec_clear(rad, n);
+    mag_clear(t);
+
+    return 1;
+}
+
+/* used when the block algorithm is not applicable */
+static void
+_arb_mat_mul_fallback(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
+{
+    if (flint_get_num_threads() > 1)
+        arb_mat_mul_threaded(C, A, B, prec);
+    else
+        arb_mat_mul_classical(C, A, B, prec);
+}
+
+/* returns 1 if all entries are finite with small exponents */
+static int
+_arb_mat_is_lagom(const arb_mat_t A)
+{
+    slong i, j;
+
+    for (i = 0; i < arb_mat_nrows(A); i++)
+        for (j = 0; j < arb_mat_ncols(A); j++)
+            if (!ARB_IS_LAGOM(arb_mat_entry(A, i, j)))
+                return 0;
+
+    return 1;
+}
+
+void
+arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
+{
+    slong ar, ac, br, bc, i, j, k;
+    slong *Ashift, *Aemid, *Aerad, *Bshift, *Bemid, *Berad;
+    double *ADmid, *ADrad, *BDmid, *BDrad;
+    double s1, s2, s3, eps;
+    fmpz_mat_t AZ, BZ, CZ;
+    arb_ptr BT;
+    arb_ptr * Bcols;
+    fmpz_t e;
+    mag_t t;
+
+    ar = arb_mat_nrows(A);
+    ac = arb_mat_ncols(A);
+    br = arb_mat_nrows(B);
+    bc = arb_mat_ncols(B);
+
+    if (ac != br || ar != arb_mat_nrows(C) || bc != arb_mat_ncols(C))
+    {
+        flint_printf("arb_mat_mul_block: incompatible dimensions\n");
+        abort();
+    }
+
+    if (br == 0)
+    {
+        arb_mat_zero(C);
+        return;
+    }
+
+    if (!_arb_mat_is_lagom(A) || !_arb_mat_is_lagom(B))
+    {
+        _arb_mat_mul_fallback(C, A, B, prec);
+        return;
+    }
+
+    if (A == C || B == C)
+    {
+        arb_mat_t T;
+        arb_mat_init(T, ar, bc);
+        arb_mat_mul_block(T, A, B, prec);
+        arb_mat_swap(T, C);
+        arb_mat_clear(T);
+        return;
+    }
+
+    /* shallow copy of B^T, so that columns of B are contiguous */
+    BT = flint_malloc(sizeof(arb_struct) * br * bc);
+    Bcols = flint_malloc(sizeof(arb_ptr) * bc);
+    _arb_mat_transpose_shallow(BT, B);
+    for (j = 0; j < bc; j++)
+        Bcols[j] = BT + j * br;
+
+    Ashift = flint_malloc(sizeof(slong) * 3 * ar);
+    Aemid = Ashift + ar;
+    Aerad = Aemid + ar;
+    Bshift = flint_malloc(sizeof(slong) * 3 * bc);
+    Bemid = Bshift + bc;
+    Berad = Bemid + bc;
+
+    ADmid = flint_malloc(sizeof(double) * 2 * ar * ac);
+    ADrad = ADmid + ar * ac;
+    BDmid = flint_malloc(sizeof(double) * 2 * bc * br);
+    BDrad = BDmid + bc * br;
+
+    fmpz_mat_init(AZ, ar, ac);
+    fmpz_mat_init(BZ, br, bc);
+    fmpz_mat_init(CZ, ar, bc);
+
+    /* midpoints: rows of A and columns of B are scaled to integers */
+    if (!_arb_mat_mul_block_split(AZ, 0, Ashift, ADmid, ADrad, Aemid, Aerad,
+            A->rows, ar, ac, prec) ||
+        !_arb_mat_mul_block_split(BZ, 1, Bshift, BDmid, BDrad, Bemid, Berad,
+            Bcols, bc, br, prec))
+    {
+        _arb_mat_mul_fallback(C, A, B, prec);
+        goto cleanup;
+    }
+
+    fmpz_mat_mul(CZ, AZ, BZ);
+
+    /* a sum of br nonnegative products computed in double precision
+       has relative error at most (br + 1) 2^-53 / (1 - (br + 1) 2^-53) */
+    eps = 1.0 + (br + 2) * ldexp(1.0, -52);
+
+    fmpz_init(e);
+    mag_init(t);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            arb_ptr c = arb_mat_entry(C, i, j);
+            const double * amid = ADmid + i * ac;
+            const double * arad = ADrad + i * ac;
+            const double * bmid = BDmid + j * br;
+            const double * brad = BDrad + j * br;
+
+            /* radius: |mid A| rad B + rad A |mid B| + rad A rad B */
+            s1 = s2 = s3 = 0.0;
+
+            for (k = 0; k < br; k++)
+            {
+                s1 += amid[k] * brad[k];
+                s2 += arad[k] * bmid[k];
+                s3 += arad[k] * brad[k];
+            }
+
+            fmpz_set_si(e, Aemid[i] + Berad[j]);
+            mag_set_d_2exp_fmpz(arb_radref(c), s1 * eps, e);
+            fmpz_set_si(e, Aerad[i] + Bemid[j]);
+            mag_set_d_2exp_fmpz(t, s2 * eps, e);
+            mag_add(arb_radref(c), arb_radref(c), t);
+            fmpz_set_si(e, Aerad[i] + Berad[j]);
+            mag_set_d_2exp_fmpz(t, s3 * eps, e);
+            mag_add(arb_radref(c), arb_radref(c), t);
+
+            /* midpoint */
+            fmpz_set_si(e, Ashift[i] + Bshift[j]);
+            if (arf_set_round_fmpz_2exp(arb_midref(c),
+                    fmpz_mat_entry(CZ, i, j), e, prec, ARB_RND))
+                arf_mag_add_ulp(arb_radref(c), arb_radref(c), arb_midref(c), prec);
+        }
+    }
+
+    fmpz_clear(e);
+    mag_clear(t);
+
+cleanup:
+    fmpz_mat_clear(AZ);
+    fmpz_mat_clear(BZ);
+    fmpz_mat_clear(CZ);
+
+    flint_free(Ashift);
+    flint_free(Bshift);
+    flint_free(ADmid);
+    flint_free(BDmid);
+    flint_free(Bcols);
+    flint_free(BT);
+}
+
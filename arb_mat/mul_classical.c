@@ -20,15 +20,59 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "arb_mat.h"
 
+/* tile sizes for the blocked kernel: a tile of rows of A is reused
+   against a tile of columns of B^T while both are in cache */
+#define TILE_ROWS 16
+#define TILE_COLS 16
+
+void
+_arb_mat_mul_classical_block(arb_mat_t C, const arb_mat_t A, arb_srcptr BT,
+    slong r0, slong r1, slong c0, slong c1, slong prec)
+{
+    slong i, j, ii, jj, i1, j1, n;
+
+    n = arb_mat_ncols(A);
+
+    for (ii = r0; ii < r1; ii += TILE_ROWS)
+    {
+        i1 = FLINT_MIN(ii + TILE_ROWS, r1);
+
+        for (jj = c0; jj < c1; jj += TILE_COLS)
+        {
+            j1 = FLINT_MIN(jj + TILE_COLS, c1);
+
+            for (i = ii; i < i1; i++)
+                for (j = jj; j < j1; j++)
+                    arb_dot(arb_mat_entry(C, i, j), NULL, 0,
+                        A->rows[i], 1, BT + j * n, 1, n, prec);
+        }
+    }
+}
+
+void
+_arb_mat_transpose_shallow(arb_ptr BT, const arb_mat_t B)
+{
+    slong i, j, r, c;
+
+    r = arb_mat_nrows(B);
+    c = arb_mat_ncols(B);
+
+    for (i = 0; i < r; i++)
+        for (j = 0; j < c; j++)
+            BT[j * r + i] = *arb_mat_entry(B, i, j);
+}
+
 void
 arb_mat_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
 {
-    slong ar, ac, br, bc, i, j, k;
+    slong ar, ac, br, bc;
+    arb_ptr BT;
 
     ar = arb_mat_nrows(A);
     ac = arb_mat_ncols(A);
@@ -57,21 +101,12 @@ arb_mat_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong p
         return;
     }
 
-    for (i = 0; i < ar; i++)
-    {
-        for (j = 0; j < bc; j++)
-        {
-            arb_mul(arb_mat_entry(C, i, j),
-                      arb_mat_entry(A, i, 0),
-                      arb_mat_entry(B, 0, j), prec);
-
-            for (k = 1; k < br; k++)
-            {
-                arb_addmul(arb_mat_entry(C, i, j),
-                             arb_mat_entry(A, i, k),
-                             arb_mat_entry(B, k, j), prec);
-            }
-        }
-    }
+    /* shallow copy of B^T, so that columns of B are contiguous */
+    BT = flint_malloc(sizeof(arb_struct) * br * bc);
+    _arb_mat_transpose_shallow(BT, B);
+
+    _arb_mat_mul_classical_block(C, A, BT, 0, ar, 0, bc, prec);
+
+    flint_free(BT);
 }
 
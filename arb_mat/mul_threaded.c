@@ -24,51 +24,36 @@
 ******************************************************************************/
 
 #include "arb_mat.h"
-#include "pthread.h"
+#include "arb_thread_pool.h"
 
 typedef struct
 {
-    arb_ptr * C;
-    const arb_ptr * A;
-    const arb_ptr * B;
-    slong ar0;
-    slong ar1;
-    slong bc0;
-    slong bc1;
-    slong br;
+    arb_mat_struct * C;
+    const arb_mat_struct * A;
+    arb_srcptr BT;
+    slong r0;
+    slong r1;
+    slong c0;
+    slong c1;
     slong prec;
 }
 arb_mat_mul_arg_t;
 
-void *
+void
 _arb_mat_mul_thread(void * arg_ptr)
 {
     arb_mat_mul_arg_t arg = *((arb_mat_mul_arg_t *) arg_ptr);
-    slong i, j, k;
 
-    for (i = arg.ar0; i < arg.ar1; i++)
-    {
-        for (j = arg.bc0; j < arg.bc1; j++)
-        {
-            arb_mul(arg.C[i] + j, arg.A[i] + 0, arg.B[0] + j, arg.prec);
-
-            for (k = 1; k < arg.br; k++)
-            {
-                arb_addmul(arg.C[i] + j, arg.A[i] + k, arg.B[k] + j, arg.prec);
-            }
-        }
-    }
-
-    flint_cleanup();
-    return NULL;
+    _arb_mat_mul_classical_block(arg.C, arg.A, arg.BT,
+        arg.r0, arg.r1, arg.c0, arg.c1, arg.prec);
 }
 
 void
 arb_mat_mul_threaded(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
 {
-    slong ar, ac, br, bc, i, num_threads;
-    pthread_t * threads;
+    slong ar, ac, br, bc, i, j, num_threads, nr, nc;
     arb_mat_mul_arg_t * args;
+    arb_ptr BT;
 
     ar = arb_mat_nrows(A);
     ac = arb_mat_ncols(A);
@@ -98,41 +83,45 @@ arb_mat_mul_threaded(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong pr
     }
 
     num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(arb_mat_mul_arg_t) * num_threads);
 
-    for (i = 0; i < num_threads; i++)
+    /* split C into a grid of nr x nc tiles, with a few tiles per thread
+       so that the pool can balance the load; always halve the longer
+       side of the tiles */
+    nr = nc = 1;
+    while (nr * nc < 4 * num_threads && (nr < ar || nc < bc))
     {
-        args[i].C = C->rows;
-        args[i].A = A->rows;
-        args[i].B = B->rows;
-
-        if (ar >= bc)
-        {
-            args[i].ar0 = (ar * i) / num_threads;
-            args[i].ar1 = (ar * (i + 1)) / num_threads;
-            args[i].bc0 = 0;
-            args[i].bc1 = bc;
-        }
+        if ((ar + nr - 1) / nr >= (bc + nc - 1) / nc && nr < ar)
+            nr = FLINT_MIN(2 * nr, ar);
         else
-        {
-            args[i].ar0 = 0;
-            args[i].ar1 = ar;
-            args[i].bc0 = (bc * i) / num_threads;
-            args[i].bc1 = (bc * (i + 1)) / num_threads;
-        }
-
-        args[i].br = br;
-        args[i].prec = prec;
-        pthread_create(&threads[i], NULL, _arb_mat_mul_thread, &args[i]);
+            nc = FLINT_MIN(2 * nc, bc);
     }
 
-    for (i = 0; i < num_threads; i++)
+    BT = flint_malloc(sizeof(arb_struct) * br * bc);
+    _arb_mat_transpose_shallow(BT, B);
+
+    args = flint_malloc(sizeof(arb_mat_mul_arg_t) * nr * nc);
+
+    for (i = 0; i < nr; i++)
     {
-        pthread_join(threads[i], NULL);
+        for (j = 0; j < nc; j++)
+        {
+            arb_mat_mul_arg_t * arg = args + i * nc + j;
+
+            arg->C = C;
+            arg->A = A;
+            arg->BT = BT;
+            arg->r0 = (ar * i) / nr;
+            arg->r1 = (ar * (i + 1)) / nr;
+            arg->c0 = (bc * j) / nc;
+            arg->c1 = (bc * (j + 1)) / nc;
+            arg->prec = prec;
+        }
     }
 
-    flint_free(threads);
+    arb_thread_pool_run(_arb_mat_mul_thread, args,
+        sizeof(arb_mat_mul_arg_t), nr * nc);
+
     flint_free(args);
+    flint_free(BT);
 }
 
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -29,14 +30,15 @@ void
 arb_mat_solve_lu_precomp(arb_mat_t X, const slong * perm,
     const arb_mat_t A, const arb_mat_t B, slong prec)
 {
-    slong i, j, c, n, m;
+    slong i, c, n, m;
+    arb_ptr tmp;
 
     n = arb_mat_nrows(X);
     m = arb_mat_ncols(X);
 
     if (X == B)
     {
-        arb_ptr tmp = flint_malloc(sizeof(arb_struct) * n);
+        tmp = flint_malloc(sizeof(arb_struct) * n);
 
         for (c = 0; c < m; c++)
         {
@@ -60,29 +62,30 @@ arb_mat_solve_lu_precomp(arb_mat_t X, const slong * perm,
         }
     }
 
+    /* the column is moved to a contiguous vector (shallowly) so that
+       the substitutions can be done with dot products */
+    tmp = flint_malloc(sizeof(arb_struct) * n);
+
     for (c = 0; c < m; c++)
     {
+        for (i = 0; i < n; i++)
+            tmp[i] = *arb_mat_entry(X, i, c);
+
         /* solve Ly = b */
         for (i = 1; i < n; i++)
-        {
-            for (j = 0; j < i; j++)
-            {
-                arb_submul(arb_mat_entry(X, i, c),
-                    arb_mat_entry(A, i, j), arb_mat_entry(X, j, c), prec);
-            }
-        }
+            arb_dot(tmp + i, tmp + i, 1, A->rows[i], 1, tmp, 1, i, prec);
 
         /* solve Ux = y */
         for (i = n - 1; i >= 0; i--)
         {
-            for (j = i + 1; j < n; j++)
-            {
-                arb_submul(arb_mat_entry(X, i, c),
-                    arb_mat_entry(A, i, j), arb_mat_entry(X, j, c), prec);
-            }
-
-            arb_div(arb_mat_entry(X, i, c), arb_mat_entry(X, i, c),
-                arb_mat_entry(A, i, i), prec);
+            arb_dot(tmp + i, tmp + i, 1, A->rows[i] + i + 1, 1,
+                tmp + i + 1, 1, n - i - 1, prec);
+            arb_div(tmp + i, tmp + i, arb_mat_entry(A, i, i), prec);
         }
+
+        for (i = 0; i < n; i++)
+            *arb_mat_entry(X, i, c) = tmp[i];
     }
+
+    flint_free(tmp);
 }
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -29,11 +30,9 @@ void
 arb_mat_sub(arb_mat_t res,
         const arb_mat_t mat1, const arb_mat_t mat2, slong prec)
 {
-    slong i, j;
+    slong i;
 
     for (i = 0; i < arb_mat_nrows(mat1); i++)
-        for (j = 0; j < arb_mat_ncols(mat1); j++)
-            arb_sub(arb_mat_entry(res, i, j),
-                arb_mat_entry(mat1, i, j),
-                arb_mat_entry(mat2, i, j), prec);
+        _arb_vec_sub(res->rows[i], mat1->rows[i], mat2->rows[i],
+            arb_mat_ncols(mat1), prec);
 }
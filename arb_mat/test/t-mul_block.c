@@ -0,0 +1,247 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_mat.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mul_block....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        slong m, n, k, qbits1, qbits2, rbits1, rbits2, rbits3;
+        fmpq_mat_t A, B, C;
+        arb_mat_t a, b, c, d;
+
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 200);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+        k = n_randint(state, 10);
+
+        fmpq_mat_init(A, m, n);
+        fmpq_mat_init(B, n, k);
+        fmpq_mat_init(C, m, k);
+
+        arb_mat_init(a, m, n);
+        arb_mat_init(b, n, k);
+        arb_mat_init(c, m, k);
+        arb_mat_init(d, m, k);
+
+        fmpq_mat_randtest(A, state, qbits1);
+        fmpq_mat_randtest(B, state, qbits2);
+        fmpq_mat_mul(C, A, B);
+
+        arb_mat_set_fmpq_mat(a, A, rbits1);
+        arb_mat_set_fmpq_mat(b, B, rbits2);
+        arb_mat_mul_block(c, a, b, rbits3);
+
+        if (!arb_mat_contains_fmpq_mat(c, C))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("m = %wd, n = %wd, k = %wd, bits3 = %wd\n", m, n, k, rbits3);
+
+            flint_printf("A = "); fmpq_mat_print(A); flint_printf("\n\n");
+            flint_printf("B = "); fmpq_mat_print(B); flint_printf("\n\n");
+            flint_printf("C = "); fmpq_mat_print(C); flint_printf("\n\n");
+
+            flint_printf("a = "); arb_mat_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); arb_mat_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); arb_mat_printd(c, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        /* test aliasing with a */
+        if (arb_mat_nrows(a) == arb_mat_nrows(c) &&
+            arb_mat_ncols(a) == arb_mat_ncols(c))
+        {
+            arb_mat_set(d, a);
+            arb_mat_mul_block(d, d, b, rbits3);
+            if (!arb_mat_equal(d, c))
+            {
+                flint_printf("FAIL (aliasing 1)\n\n");
+                abort();
+            }
+        }
+
+        /* test aliasing with b */
+        if (arb_mat_nrows(b) == arb_mat_nrows(c) &&
+            arb_mat_ncols(b) == arb_mat_ncols(c))
+        {
+            arb_mat_set(d, b);
+            arb_mat_mul_block(d, a, d, rbits3);
+            if (!arb_mat_equal(d, c))
+            {
+                flint_printf("FAIL (aliasing 2)\n\n");
+                abort();
+            }
+        }
+
+        fmpq_mat_clear(A);
+        fmpq_mat_clear(B);
+        fmpq_mat_clear(C);
+
+        arb_mat_clear(a);
+        arb_mat_clear(b);
+        arb_mat_clear(c);
+        arb_mat_clear(d);
+    }
+
+    /* inexact and special entries: compare with the classical product */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        slong m, n, k, prec;
+        arb_mat_t a, b, c, d;
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+        k = n_randint(state, 10);
+        prec = 2 + n_randint(state, 500);
+
+        arb_mat_init(a, m, n);
+        arb_mat_init(b, n, k);
+        arb_mat_init(c, m, k);
+        arb_mat_init(d, m, k);
+
+        arb_mat_randtest(a, state, 1 + n_randint(state, 500), 1 + n_randint(state, 10));
+        arb_mat_randtest(b, state, 1 + n_randint(state, 500), 1 + n_randint(state, 10));
+
+        arb_mat_mul_block(c, a, b, prec);
+        arb_mat_mul_classical(d, a, b, prec);
+
+        if (!arb_mat_overlaps(c, d))
+        {
+            flint_printf("FAIL (overlap)\n\n");
+            flint_printf("a = "); arb_mat_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); arb_mat_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); arb_mat_printd(c, 15); flint_printf("\n\n");
+            flint_printf("d = "); arb_mat_printd(d, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_mat_clear(a);
+        arb_mat_clear(b);
+        arb_mat_clear(c);
+        arb_mat_clear(d);
+    }
+
+    /* exact positive entries of widely varying magnitude: the accuracy
+       must be as good as that of the classical product */
+    for (iter = 0; iter < 3000; iter++)
+    {
+        slong m, n, k, i, j, prec, spread, acc1, acc2;
+        arb_mat_t a, b, c, d;
+
+        m = 1 + n_randint(state, 12);
+        n = 1 + n_randint(state, 12);
+        k = 1 + n_randint(state, 12);
+        prec = 2 + n_randint(state, 600);
+        spread = n_randint(state, 1000);
+
+        arb_mat_init(a, m, n);
+        arb_mat_init(b, n, k);
+        arb_mat_init(c, m, k);
+        arb_mat_init(d, m, k);
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                arb_randtest_exact(arb_mat_entry(a, i, j), state, 1 + n_randint(state, prec), 2);
+                arb_abs(arb_mat_entry(a, i, j), arb_mat_entry(a, i, j));
+                arb_mul_2exp_si(arb_mat_entry(a, i, j), arb_mat_entry(a, i, j),
+                    (slong) n_randint(state, spread + 1) - spread / 2);
+            }
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < k; j++)
+            {
+                arb_randtest_exact(arb_mat_entry(b, i, j), state, 1 + n_randint(state, prec), 2);
+                arb_abs(arb_mat_entry(b, i, j), arb_mat_entry(b, i, j));
+                arb_mul_2exp_si(arb_mat_entry(b, i, j), arb_mat_entry(b, i, j),
+                    (slong) n_randint(state, spread + 1) - spread / 2);
+            }
+        }
+
+        /* e.g. the row [2^500, 1] times the column [0, 1] */
+        if (n >= 2 && n_randint(state, 4) == 0)
+        {
+            arb_one(arb_mat_entry(a, 0, 0));
+            arb_mul_2exp_si(arb_mat_entry(a, 0, 0), arb_mat_entry(a, 0, 0), 500);
+            arb_one(arb_mat_entry(a, 0, 1));
+            arb_zero(arb_mat_entry(b, 0, 0));
+            arb_one(arb_mat_entry(b, 1, 0));
+        }
+
+        arb_mat_mul_block(c, a, b, prec);
+        arb_mat_mul_classical(d, a, b, prec);
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < k; j++)
+            {
+                acc1 = arb_rel_accuracy_bits(arb_mat_entry(c, i, j));
+                acc2 = arb_rel_accuracy_bits(arb_mat_entry(d, i, j));
+
+                if (!arb_overlaps(arb_mat_entry(c, i, j), arb_mat_entry(d, i, j)) ||
+                    acc1 < FLINT_MIN(acc2, prec) - 3)
+                {
+                    flint_printf("FAIL (accuracy)\n\n");
+                    flint_printf("m = %wd, n = %wd, k = %wd, prec = %wd, spread = %wd\n",
+                        m, n, k, prec, spread);
+                    flint_printf("i = %wd, j = %wd, acc1 = %wd, acc2 = %wd\n\n",
+                        i, j, acc1, acc2);
+                    flint_printf("c = "); arb_printd(arb_mat_entry(c, i, j), 30); flint_printf("\n\n");
+                    flint_printf("d = "); arb_printd(arb_mat_entry(d, i, j), 30); flint_printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        arb_mat_clear(a);
+        arb_mat_clear(b);
+        arb_mat_clear(c);
+        arb_mat_clear(d);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
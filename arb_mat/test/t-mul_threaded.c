@@ -40,7 +40,7 @@ int main()
     {
         slong m, n, k, qbits1, qbits2, rbits1, rbits2, rbits3;
         fmpq_mat_t A, B, C;
-        arb_mat_t a, b, c, d;
+        arb_mat_t a, b, c, d, e;
 
         flint_set_num_threads(1 + n_randint(state, 5));
 
@@ -50,9 +50,18 @@ int main()
         rbits2 = 2 + n_randint(state, 200);
         rbits3 = 2 + n_randint(state, 200);
 
-        m = n_randint(state, 10);
-        n = n_randint(state, 10);
-        k = n_randint(state, 10);
+        if (n_randint(state, 20) == 0)
+        {
+            m = n_randint(state, 50);
+            n = n_randint(state, 50);
+            k = n_randint(state, 50);
+        }
+        else
+        {
+            m = n_randint(state, 10);
+            n = n_randint(state, 10);
+            k = n_randint(state, 10);
+        }
 
         fmpq_mat_init(A, m, n);
         fmpq_mat_init(B, n, k);
@@ -62,6 +71,7 @@ int main()
         arb_mat_init(b, n, k);
         arb_mat_init(c, m, k);
         arb_mat_init(d, m, k);
+        arb_mat_init(e, m, k);
 
         fmpq_mat_randtest(A, state, qbits1);
         fmpq_mat_randtest(B, state, qbits2);
@@ -88,6 +98,17 @@ int main()
             abort();
         }
 
+        /* both versions evaluate each entry with a single dot product */
+        arb_mat_mul_classical(e, a, b, rbits3);
+
+        if (!arb_mat_equal(c, e))
+        {
+            flint_printf("FAIL (classical)\n\n");
+            flint_printf("threads = %d, m = %wd, n = %wd, k = %wd, bits3 = %wd\n",
+                flint_get_num_threads(), m, n, k, rbits3);
+            abort();
+        }
+
         /* test aliasing with a */
         if (arb_mat_nrows(a) == arb_mat_nrows(c) &&
             arb_mat_ncols(a) == arb_mat_ncols(c))
@@ -122,6 +143,7 @@ int main()
         arb_mat_clear(b);
         arb_mat_clear(c);
         arb_mat_clear(d);
+        arb_mat_clear(e);
     }
 
     flint_randclear(state);
@@ -251,6 +251,18 @@ void _arb_poly_mullow(arb_ptr C,
 void arb_poly_mullow(arb_poly_t res, const arb_poly_t poly1,
               const arb_poly_t poly2, slong len, slong prec);
 
+void _arb_poly_mulhigh(arb_ptr res, arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong nlo, slong prec);
+
+void arb_poly_mulhigh(arb_poly_t res, const arb_poly_t poly1,
+              const arb_poly_t poly2, slong nlo, slong prec);
+
+void _arb_poly_mulmid(arb_ptr res, arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong nlo, slong nhi, slong prec);
+
+void arb_poly_mulmid(arb_poly_t res, const arb_poly_t poly1,
+              const arb_poly_t poly2, slong nlo, slong nhi, slong prec);
+
 void _arb_poly_mul(arb_ptr C,
     arb_srcptr A, slong lenA,
     arb_srcptr B, slong lenB, slong prec);
@@ -439,6 +451,43 @@ void _arb_poly_interpolate_fast(arb_ptr poly,
 void arb_poly_interpolate_fast(arb_poly_t poly,
         arb_srcptr xs, arb_srcptr ys, slong n, slong prec);
 
+/* Precomputed nodes */
+
+typedef struct
+{
+    arb_ptr xs;
+    arb_ptr * tree;
+    arb_ptr weights;
+    slong len;
+}
+arb_poly_nodes_struct;
+
+typedef arb_poly_nodes_struct arb_poly_nodes_t[1];
+
+#define arb_poly_nodes_length(T) ((T)->len)
+
+void arb_poly_nodes_init(arb_poly_nodes_t T, arb_srcptr xs, slong n, slong prec);
+
+void arb_poly_nodes_clear(arb_poly_nodes_t T);
+
+void _arb_poly_nodes_evaluate_vec(arb_ptr ys, arb_srcptr poly, slong plen,
+    const arb_poly_nodes_t T, slong prec);
+
+void arb_poly_nodes_evaluate_vec(arb_ptr ys, const arb_poly_t poly,
+    const arb_poly_nodes_t T, slong prec);
+
+void arb_poly_nodes_evaluate_vec_batch(arb_ptr ys, const arb_poly_struct * polys,
+    slong num, const arb_poly_nodes_t T, slong prec);
+
+void _arb_poly_nodes_interpolate(arb_ptr poly, arb_srcptr ys,
+    const arb_poly_nodes_t T, slong prec);
+
+void arb_poly_nodes_interpolate(arb_poly_t poly, arb_srcptr ys,
+    const arb_poly_nodes_t T, slong prec);
+
+void arb_poly_nodes_evaluate_interpolant(arb_t res, arb_srcptr ys,
+    const arb_poly_nodes_t T, const arb_t t, slong prec);
+
 /* Derivative and integral */
 
 void _arb_poly_derivative(arb_ptr res, arb_srcptr poly, slong len, slong prec);
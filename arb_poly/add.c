@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -31,8 +32,7 @@ _arb_poly_add(arb_ptr res, arb_srcptr poly1, slong len1,
 {
     slong i, min = FLINT_MIN(len1, len2);
 
-    for (i = 0; i < min; i++)
-        arb_add(res + i, poly1 + i, poly2 + i, prec);
+    _arb_vec_add(res, poly1, poly2, min, prec);
 
     for (i = min; i < len1; i++)
         arb_set_round(res + i, poly1 + i, prec);
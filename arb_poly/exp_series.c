@@ -60,14 +60,14 @@ _arb_poly_exp_series_newton(arb_ptr f, arb_ptr g,
     slong l = m - 1; /* shifted for derivative */
 
     /* g := exp(-h) + O(x^m) */
-    _arb_poly_mullow(T, f, m, g, m2, m, prec);
-    _arb_poly_mullow(g + m2, g, m2, T + m2, m - m2, m - m2, prec);
+    _arb_poly_mulmid(T, f, m, g, m2, m2, m, prec);
+    _arb_poly_mullow(g + m2, g, m2, T, m - m2, m - m2, prec);
     _arb_vec_neg(g + m2, g + m2, m - m2);
 
     /* U := h' + g (f' - f h') + O(x^(n-1))
         Note: should replace h' by h' mod x^(m-1) */
     _arb_vec_zero(f + m, n - m);
-    _arb_poly_mullow(T, f, n, hprime, n, n, prec); /* should be mulmid */
+    _arb_poly_mulmid(T + l, f, m, hprime, n, l, n, prec);
     _arb_poly_derivative(U, f, n, prec); arb_zero(U + n - 1); /* should skip low terms */
     _arb_vec_sub(U + l, U + l, T + l, n - l, prec);
     _arb_poly_mullow(T + l, g, n - m, U + l, n - m, n - m, prec);
@@ -82,8 +82,8 @@ _arb_poly_exp_series_newton(arb_ptr f, arb_ptr g,
     /* not needed if we only want exp(x) */
     if (n == len && inverse)
     {
-        _arb_poly_mullow(T, f, n, g, m, n, prec);
-        _arb_poly_mullow(g + m, g, m, T + m, n - m, n - m, prec);
+        _arb_poly_mulmid(T, f, n, g, m, m, n, prec);
+        _arb_poly_mullow(g + m, g, m, T, n - m, n - m, prec);
         _arb_vec_neg(g + m, g + m, n - m);
     }
 
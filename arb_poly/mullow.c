@@ -20,13 +20,12 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "arb_poly.h"
 
-#define BLOCK_CUTOFF 16
-
 void
 _arb_poly_mullow(arb_ptr res,
     arb_srcptr poly1, slong len1,
@@ -38,7 +37,9 @@ _arb_poly_mullow(arb_ptr res,
     }
     else
     {
-        if (n < BLOCK_CUTOFF || len1 < BLOCK_CUTOFF || len2 < BLOCK_CUTOFF)
+        slong cutoff = arb_tune_get(ARB_TUNE_POLY_MULLOW_BLOCK, prec);
+
+        if (n < cutoff || len1 < cutoff || len2 < cutoff)
             _arb_poly_mullow_classical(res, poly1, len1, poly2, len2, n, prec);
         else
             _arb_poly_mullow_block(res, poly1, len1, poly2, len2, n, prec);
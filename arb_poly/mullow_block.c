@@ -25,6 +25,7 @@
 
 #include <math.h>
 #include "arb_poly.h"
+#include "arb_thread_pool.h"
 
 void
 _arb_poly_get_scale(fmpz_t scale, arb_srcptr x, slong xlen,
@@ -469,6 +470,474 @@ _arb_poly_addmullow_block(arb_ptr z, fmpz * zz,
     fmpz_clear(zexp);
 }
 
+/* Threaded versions of the above. Each block product is split into
+   tasks which compute exact subproducts (or, for the radius bounds,
+   ranges of the double sums), and the tasks of consecutive block
+   products are run in parallel in waves. The results of each block
+   product are then added to the output in the same order as in the
+   serial code, so that the output does not depend on the number
+   of threads. */
+
+/* minimum length times bit size of the operands of a task computing
+   an exact subproduct, and minimum number of double multiplications
+   of a task computing part of a double product */
+#define THREADED_MIN_WORK (WORD(1) << 20)
+#define THREADED_DOUBLE_MIN_WORK (WORD(1) << 17)
+
+typedef struct
+{
+    fmpz * z;
+    double * d;
+    const fmpz * x;
+    const fmpz * y;
+    const double * xd;
+    const double * yd;
+    slong xlen;
+    slong ylen;
+    slong start;
+    slong n;
+    slong offset;
+    int squaring;
+    int twice;
+}
+block_task_t;
+
+typedef struct
+{
+    slong i;
+    slong j;
+    slong zpos;
+    slong bn;
+    slong extra_exp;
+    slong task_start;
+    slong task_end;
+    fmpz * zz;
+    double * dd;
+}
+block_pair_t;
+
+static void
+_block_task_worker(void * arg_ptr)
+{
+    block_task_t * arg = (block_task_t *) arg_ptr;
+    slong k, ii;
+    double ss;
+
+    if (arg->d != NULL)
+    {
+        /* same summation order as in _arb_poly_addmullow_rad */
+        for (k = arg->start; k < arg->n; k++)
+        {
+            ss = 0.0;
+
+            for (ii = FLINT_MAX(0, k - arg->ylen + 1);
+                ii <= FLINT_MIN(arg->xlen - 1, k); ii++)
+            {
+                ss += arg->xd[ii] * arg->yd[k - ii];
+            }
+
+            arg->d[k] = ss;
+        }
+    }
+    else if (arg->squaring)
+    {
+        _fmpz_poly_sqrlow(arg->z, arg->x, arg->xlen, arg->n);
+    }
+    else if (arg->xlen >= arg->ylen)
+    {
+        _fmpz_poly_mullow(arg->z, arg->x, arg->xlen, arg->y, arg->ylen, arg->n);
+    }
+    else
+    {
+        _fmpz_poly_mullow(arg->z, arg->y, arg->ylen, arg->x, arg->xlen, arg->n);
+    }
+}
+
+static slong
+_block_num_chunks(double work, double min_work, slong num_threads)
+{
+    if (work < 2 * min_work)
+        return 1;
+
+    return FLINT_MIN(num_threads, (slong) (work / min_work));
+}
+
+/* Appends tasks computing {x, xl} * {y, yl} (or {x, xl}^2) mod x^bn
+   exactly, splitting x into chunks. Returns the number of tasks. */
+static slong
+_block_plan_fmpz(block_task_t * tasks, const fmpz * x, slong xl,
+    const fmpz * y, slong yl, slong bn, int squaring, slong c)
+{
+    slong a, b, len, alen, blen, num;
+
+    num = 0;
+
+    if (squaring)
+    {
+        /* x = sum x_a t^(a len); the products x_a x_b with a < b
+           appear twice */
+        c = FLINT_MAX(1, n_sqrt(2 * c));
+        len = (xl + c - 1) / c;
+
+        for (a = 0; a * len < xl; a++)
+        {
+            for (b = a; b * len < xl; b++)
+            {
+                if ((a + b) * len >= bn)
+                    continue;
+
+                alen = FLINT_MIN(len, xl - a * len);
+                blen = FLINT_MIN(len, xl - b * len);
+
+                tasks[num].d = NULL;
+                tasks[num].x = x + a * len;
+                tasks[num].xlen = alen;
+                tasks[num].y = x + b * len;
+                tasks[num].ylen = blen;
+                tasks[num].offset = (a + b) * len;
+                tasks[num].n = FLINT_MIN(alen + blen - 1, bn - tasks[num].offset);
+                tasks[num].squaring = (a == b);
+                tasks[num].twice = (a != b);
+                tasks[num].xlen = FLINT_MIN(alen, tasks[num].n);
+                tasks[num].ylen = FLINT_MIN(blen, tasks[num].n);
+                num++;
+            }
+        }
+    }
+    else
+    {
+        len = (xl + c - 1) / c;
+
+        for (a = 0; a * len < xl && a * len < bn; a++)
+        {
+            alen = FLINT_MIN(len, xl - a * len);
+
+            tasks[num].d = NULL;
+            tasks[num].x = x + a * len;
+            tasks[num].y = y;
+            tasks[num].offset = a * len;
+            tasks[num].n = FLINT_MIN(alen + yl - 1, bn - tasks[num].offset);
+            tasks[num].xlen = FLINT_MIN(alen, tasks[num].n);
+            tasks[num].ylen = FLINT_MIN(yl, tasks[num].n);
+            tasks[num].squaring = 0;
+            tasks[num].twice = 0;
+            num++;
+        }
+    }
+
+    for (a = 0; a < num; a++)
+        tasks[a].z = _fmpz_vec_init(tasks[a].n);
+
+    return num;
+}
+
+/* Runs the tasks of the given block products and sums the chunks of
+   each exact product. */
+static void
+_block_run_wave(block_pair_t * pairs, slong num_pairs,
+    block_task_t * tasks, slong num_tasks)
+{
+    slong p, k;
+    block_task_t * t;
+
+    arb_thread_pool_run(_block_task_worker, tasks, sizeof(block_task_t), num_tasks);
+
+    for (p = 0; p < num_pairs; p++)
+    {
+        if (pairs[p].dd != NULL)
+            continue;
+
+        pairs[p].zz = _fmpz_vec_init(pairs[p].bn);
+
+        for (k = pairs[p].task_start; k < pairs[p].task_end; k++)
+        {
+            t = tasks + k;
+
+            if (t->twice)
+                _fmpz_vec_scalar_addmul_si(pairs[p].zz + t->offset, t->z, t->n, 2);
+            else
+                _fmpz_vec_add(pairs[p].zz + t->offset,
+                    pairs[p].zz + t->offset, t->z, t->n);
+
+            _fmpz_vec_clear(t->z, t->n);
+        }
+    }
+}
+
+/* Adds the block products of a wave to the radii of z. */
+static void
+_block_flush_rad(arb_ptr z, block_pair_t * pairs, slong num_pairs,
+    block_task_t * tasks, slong num_tasks,
+    const fmpz * xexps, const fmpz * yexps)
+{
+    slong k, m;
+    block_pair_t * pr;
+    fmpz_t zexp;
+    mag_t t;
+
+    fmpz_init(zexp);
+    mag_init(t);
+
+    _block_run_wave(pairs, num_pairs, tasks, num_tasks);
+
+    for (k = 0; k < num_pairs; k++)
+    {
+        pr = pairs + k;
+
+        fmpz_add_inline(zexp, xexps + pr->i, yexps + pr->j);
+        fmpz_add_ui(zexp, zexp, pr->extra_exp);
+
+        for (m = 0; m < pr->bn; m++)
+        {
+            if (pr->dd != NULL)
+            {
+                /* Compensate for rounding error */
+                mag_set_d_2exp_fmpz(t, pr->dd[m] * DOUBLE_ROUNDING_FACTOR, zexp);
+            }
+            else
+            {
+                mag_set_fmpz_2exp_fmpz(t, pr->zz + m, zexp);
+            }
+
+            mag_add(arb_radref(z + pr->zpos + m),
+                    arb_radref(z + pr->zpos + m), t);
+        }
+
+        if (pr->dd != NULL)
+            flint_free(pr->dd);
+        else
+            _fmpz_vec_clear(pr->zz, pr->bn);
+    }
+
+    fmpz_clear(zexp);
+    mag_clear(t);
+}
+
+/* Adds the block products of a wave to the midpoints of z. */
+static void
+_block_flush_mid(arb_ptr z, block_pair_t * pairs, slong num_pairs,
+    block_task_t * tasks, slong num_tasks,
+    const fmpz * xexps, const fmpz * yexps, slong prec)
+{
+    slong k, m;
+    block_pair_t * pr;
+    fmpz_t zexp;
+
+    fmpz_init(zexp);
+
+    _block_run_wave(pairs, num_pairs, tasks, num_tasks);
+
+    for (k = 0; k < num_pairs; k++)
+    {
+        pr = pairs + k;
+
+        _fmpz_add2_fast(zexp, xexps + pr->i, yexps + pr->j, pr->extra_exp);
+
+        for (m = 0; m < pr->bn; m++)
+            arb_add_fmpz_2exp(z + pr->zpos + m, z + pr->zpos + m,
+                pr->zz + m, zexp, prec);
+
+        _fmpz_vec_clear(pr->zz, pr->bn);
+    }
+
+    fmpz_clear(zexp);
+}
+
+/* a wave is run when it has this many pairs or tasks; a single
+   block product creates at most 2 * num_threads tasks */
+#define WAVE_SIZE(num_threads) (4 * (num_threads))
+#define WAVE_ALLOC(num_threads) (6 * (num_threads) + 2)
+
+static void
+_arb_poly_addmullow_rad_threaded(arb_ptr z,
+    const fmpz * xz, const double * xdbl, const fmpz * xexps,
+    const slong * xblocks, slong xlen,
+    const fmpz * yz, const double * ydbl, const fmpz * yexps,
+    const slong * yblocks, slong ylen, slong n, slong num_threads)
+{
+    slong i, j, k, xp, yp, xl, yl, bn, c, num_pairs, num_tasks;
+    block_pair_t * pairs;
+    block_task_t * tasks;
+    double work;
+
+    pairs = flint_malloc(sizeof(block_pair_t) * WAVE_ALLOC(num_threads));
+    tasks = flint_malloc(sizeof(block_task_t) * WAVE_ALLOC(num_threads));
+    num_pairs = num_tasks = 0;
+
+    for (i = 0; (xp = xblocks[i]) != xlen; i++)
+    {
+        for (j = 0; (yp = yblocks[j]) != ylen; j++)
+        {
+            if (xp + yp >= n)
+                continue;
+
+            xl = xblocks[i + 1] - xp;
+            yl = yblocks[j + 1] - yp;
+            bn = FLINT_MIN(xl + yl - 1, n - xp - yp);
+            xl = FLINT_MIN(xl, bn);
+            yl = FLINT_MIN(yl, bn);
+
+            pairs[num_pairs].i = i;
+            pairs[num_pairs].j = j;
+            pairs[num_pairs].zpos = xp + yp;
+            pairs[num_pairs].bn = bn;
+            pairs[num_pairs].task_start = num_tasks;
+
+            if (xl > 1 && yl > 1 &&
+                (xl < DOUBLE_BLOCK_MAX_LENGTH || yl < DOUBLE_BLOCK_MAX_LENGTH))
+            {
+                pairs[num_pairs].extra_exp = 2 * DOUBLE_BLOCK_SHIFT;
+                pairs[num_pairs].dd = flint_malloc(sizeof(double) * bn);
+
+                work = (double) xl * (double) yl;
+                c = _block_num_chunks(work, THREADED_DOUBLE_MIN_WORK, num_threads);
+
+                for (k = 0; k < c; k++)
+                {
+                    tasks[num_tasks].d = pairs[num_pairs].dd;
+                    tasks[num_tasks].xd = xdbl + xp;
+                    tasks[num_tasks].yd = ydbl + yp;
+                    tasks[num_tasks].xlen = xl;
+                    tasks[num_tasks].ylen = yl;
+                    tasks[num_tasks].start = (bn * k) / c;
+                    tasks[num_tasks].n = (bn * (k + 1)) / c;
+                    num_tasks++;
+                }
+            }
+            else
+            {
+                pairs[num_pairs].extra_exp = 0;
+                pairs[num_pairs].dd = NULL;
+
+                work = (double) (xl + yl) * (ALPHA * MAG_BITS + BETA);
+                c = _block_num_chunks(work, THREADED_MIN_WORK, num_threads);
+
+                if (xl >= yl)
+                    num_tasks += _block_plan_fmpz(tasks + num_tasks,
+                        xz + xp, xl, yz + yp, yl, bn, 0, c);
+                else
+                    num_tasks += _block_plan_fmpz(tasks + num_tasks,
+                        yz + yp, yl, xz + xp, xl, bn, 0, c);
+            }
+
+            pairs[num_pairs].task_end = num_tasks;
+            num_pairs++;
+
+            if (num_pairs >= WAVE_SIZE(num_threads) ||
+                num_tasks >= WAVE_SIZE(num_threads))
+            {
+                _block_flush_rad(z, pairs, num_pairs, tasks, num_tasks,
+                    xexps, yexps);
+                num_pairs = num_tasks = 0;
+            }
+        }
+    }
+
+    if (num_pairs != 0)
+        _block_flush_rad(z, pairs, num_pairs, tasks, num_tasks, xexps, yexps);
+
+    flint_free(pairs);
+    flint_free(tasks);
+}
+
+static void
+_arb_poly_addmullow_block_threaded(arb_ptr z,
+    const fmpz * xz, const fmpz * xexps, const slong * xblocks, slong xlen,
+    const fmpz * yz, const fmpz * yexps, const slong * yblocks, slong ylen,
+    slong n, slong prec, int squaring, slong num_threads)
+{
+    slong i, j, xp, yp, xl, yl, bn, c, num_pairs, num_tasks, pass;
+    block_pair_t * pairs;
+    block_task_t * tasks;
+    double work;
+
+    pairs = flint_malloc(sizeof(block_pair_t) * WAVE_ALLOC(num_threads));
+    tasks = flint_malloc(sizeof(block_task_t) * WAVE_ALLOC(num_threads));
+    num_pairs = num_tasks = 0;
+
+    /* the same block products in the same order as in
+       _arb_poly_addmullow_block: for squaring, first the squares of
+       the diagonal blocks, and then the products of distinct blocks,
+       which appear twice */
+    for (pass = squaring ? 0 : 1; pass < 2; pass++)
+    {
+        for (i = 0; (xp = xblocks[i]) != xlen; i++)
+        {
+            for (j = (pass == 0) ? i : (squaring ? i + 1 : 0);
+                (yp = yblocks[j]) != ylen; j++)
+            {
+                if (pass == 0 && j != i)
+                    break;
+
+                if (xp + yp >= n)
+                    continue;
+
+                xl = xblocks[i + 1] - xp;
+                yl = yblocks[j + 1] - yp;
+                bn = FLINT_MIN(xl + yl - 1, n - xp - yp);
+                xl = FLINT_MIN(xl, bn);
+                yl = FLINT_MIN(yl, bn);
+
+                pairs[num_pairs].i = i;
+                pairs[num_pairs].j = j;
+                pairs[num_pairs].zpos = xp + yp;
+                pairs[num_pairs].bn = bn;
+                pairs[num_pairs].extra_exp = (pass == 1 && squaring);
+                pairs[num_pairs].dd = NULL;
+                pairs[num_pairs].task_start = num_tasks;
+
+                work = (double) (xl + yl) * (ALPHA * prec + BETA);
+                c = _block_num_chunks(work, THREADED_MIN_WORK, num_threads);
+
+                if (pass == 0)
+                    num_tasks += _block_plan_fmpz(tasks + num_tasks,
+                        xz + xp, xl, NULL, 0, bn, 1, c);
+                else if (xl >= yl)
+                    num_tasks += _block_plan_fmpz(tasks + num_tasks,
+                        xz + xp, xl, yz + yp, yl, bn, 0, c);
+                else
+                    num_tasks += _block_plan_fmpz(tasks + num_tasks,
+                        yz + yp, yl, xz + xp, xl, bn, 0, c);
+
+                pairs[num_pairs].task_end = num_tasks;
+                num_pairs++;
+
+                if (num_pairs >= WAVE_SIZE(num_threads) ||
+                    num_tasks >= WAVE_SIZE(num_threads))
+                {
+                    _block_flush_mid(z, pairs, num_pairs, tasks, num_tasks,
+                        xexps, yexps, prec);
+                    num_pairs = num_tasks = 0;
+                }
+            }
+        }
+    }
+
+    if (num_pairs != 0)
+        _block_flush_mid(z, pairs, num_pairs, tasks, num_tasks,
+            xexps, yexps, prec);
+
+    flint_free(pairs);
+    flint_free(tasks);
+}
+
+/* dispatch to the threaded versions */
+#define ADDMULLOW_RAD(xz, xdbl, xe, xblocks, xlen, yz, ydbl, ye, yblocks, ylen) \
+    if (num_threads > 1) \
+        _arb_poly_addmullow_rad_threaded(z, xz, xdbl, xe, xblocks, xlen, \
+            yz, ydbl, ye, yblocks, ylen, n, num_threads); \
+    else \
+        _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xlen, \
+            yz, ydbl, ye, yblocks, ylen, n)
+
+#define ADDMULLOW_BLOCK(xz, xe, xblocks, xlen, yz, ye, yblocks, ylen, sqr) \
+    if (num_threads > 1) \
+        _arb_poly_addmullow_block_threaded(z, xz, xe, xblocks, xlen, \
+            yz, ye, yblocks, ylen, n, prec, sqr, num_threads); \
+    else \
+        _arb_poly_addmullow_block(z, zz, xz, xe, xblocks, xlen, \
+            yz, ye, yblocks, ylen, n, prec, sqr)
+
 void
 _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
                                 arb_srcptr y, slong ylen, slong n, slong prec)
@@ -477,6 +946,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
     fmpz *xz, *yz, *zz;
     fmpz *xe, *ye;
     slong *xblocks, *yblocks;
+    slong num_threads;
     int squaring;
     fmpz_t scale, t;
 
@@ -522,6 +992,12 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
 
     n = FLINT_MIN(n, xlen + ylen - 1);
 
+    /* only use threads for products with enough work */
+    num_threads = flint_get_num_threads();
+    if ((double) xlen * (double) ylen < 2 * THREADED_DOUBLE_MIN_WORK &&
+        (double) (xlen + ylen) * prec < 2 * THREADED_MIN_WORK)
+        num_threads = 1;
+
     fmpz_init(scale);
     fmpz_init(t);
     xz = _fmpz_vec_init(xlen);
@@ -560,7 +1036,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
             }
 
             _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, tmp, xlen);
-            _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, xlen, n);
+            ADDMULLOW_RAD(xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, xlen);
         }
         else if (yrlen == 0)
         {
@@ -571,7 +1047,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
                 arf_get_mag(tmp + i, arb_midref(y + i));
 
             _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, tmp, ymlen);
-            _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ymlen, n);
+            ADDMULLOW_RAD(xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ymlen);
         }
         else
         {
@@ -581,7 +1057,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
 
             _mag_vec_get_fmpz_2exp_blocks(xz, xdbl, xe, xblocks, scale, NULL, tmp, xmlen);
             _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, y, NULL, yrlen);
-            _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xmlen, yz, ydbl, ye, yblocks, yrlen, n);
+            ADDMULLOW_RAD(xz, xdbl, xe, xblocks, xmlen, yz, ydbl, ye, yblocks, yrlen);
 
             /* xr*(|ym| + yr) */
             if (xrlen != 0)
@@ -592,7 +1068,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
                     arb_get_mag(tmp + i, y + i);
 
                 _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, tmp, ylen);
-                _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ylen, n);
+                ADDMULLOW_RAD(xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ylen);
             }
         }
 
@@ -608,12 +1084,12 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
 
         if (squaring)
         {
-            _arb_poly_addmullow_block(z, zz, xz, xe, xblocks, xmlen, xz, xe, xblocks, xmlen, n, prec, 1);
+            ADDMULLOW_BLOCK(xz, xe, xblocks, xmlen, xz, xe, xblocks, xmlen, 1);
         }
         else
         {
             _arb_vec_get_fmpz_2exp_blocks(yz, ye, yblocks, scale, y, ymlen, prec);
-            _arb_poly_addmullow_block(z, zz, xz, xe, xblocks, xmlen, yz, ye, yblocks, ymlen, n, prec, 0);
+            ADDMULLOW_BLOCK(xz, xe, xblocks, xmlen, yz, ye, yblocks, ymlen, 0);
         }
     }
 
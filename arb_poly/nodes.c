@@ -0,0 +1,48 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+void
+arb_poly_nodes_init(arb_poly_nodes_t T, arb_srcptr xs, slong n, slong prec)
+{
+    T->len = n;
+    T->xs = _arb_vec_init(n);
+    T->weights = _arb_vec_init(n);
+    T->tree = _arb_poly_tree_alloc(n);
+
+    _arb_vec_set(T->xs, xs, n);
+    _arb_poly_tree_build(T->tree, xs, n, prec);
+    _arb_poly_interpolation_weights(T->weights, T->tree, n, prec);
+}
+
+void
+arb_poly_nodes_clear(arb_poly_nodes_t T)
+{
+    _arb_vec_clear(T->xs, T->len);
+    _arb_vec_clear(T->weights, T->len);
+    _arb_poly_tree_free(T->tree, T->len);
+}
+
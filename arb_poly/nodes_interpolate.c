@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+void
+_arb_poly_nodes_interpolate(arb_ptr poly, arb_srcptr ys,
+    const arb_poly_nodes_t T, slong prec)
+{
+    _arb_poly_interpolate_fast_precomp(poly, ys, T->tree, T->weights,
+        T->len, prec);
+}
+
+void
+arb_poly_nodes_interpolate(arb_poly_t poly, arb_srcptr ys,
+    const arb_poly_nodes_t T, slong prec)
+{
+    slong n = T->len;
+
+    if (n == 0)
+    {
+        arb_poly_zero(poly);
+    }
+    else
+    {
+        arb_poly_fit_length(poly, n);
+        _arb_poly_set_length(poly, n);
+        _arb_poly_nodes_interpolate(poly->coeffs, ys, T, prec);
+        _arb_poly_normalise(poly);
+    }
+}
+
+void
+arb_poly_nodes_evaluate_interpolant(arb_t res, arb_srcptr ys,
+    const arb_poly_nodes_t T, const arb_t t, slong prec)
+{
+    arb_ptr d, suffix;
+    arb_t s, prefix, u;
+    slong i, n = T->len;
+
+    if (n == 0)
+    {
+        arb_zero(res);
+        return;
+    }
+
+    d = _arb_vec_init(n);
+    suffix = _arb_vec_init(n + 1);
+    arb_init(s);
+    arb_init(prefix);
+    arb_init(u);
+
+    /* p(t) = sum_i y_i w_i prod_{j != i} (t - x_j), with the products
+       over j < i and j > i formed incrementally, so that no division
+       is needed when t is close to one of the nodes */
+    for (i = 0; i < n; i++)
+        arb_sub(d + i, t, T->xs + i, prec);
+
+    arb_one(suffix + n);
+    for (i = n - 1; i > 0; i--)
+        arb_mul(suffix + i, suffix + i + 1, d + i, prec);
+
+    arb_one(prefix);
+    for (i = 0; i < n; i++)
+    {
+        arb_mul(u, ys + i, T->weights + i, prec);
+        arb_mul(u, u, prefix, prec);
+        arb_addmul(s, u, suffix + i + 1, prec);
+        arb_mul(prefix, prefix, d + i, prec);
+    }
+
+    arb_swap(res, s);
+
+    _arb_vec_clear(d, n);
+    _arb_vec_clear(suffix, n + 1);
+    arb_clear(s);
+    arb_clear(prefix);
+    arb_clear(u);
+}
+
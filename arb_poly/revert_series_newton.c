@@ -30,7 +30,7 @@
 void
 _arb_poly_revert_series_newton(arb_ptr Qinv, arb_srcptr Q, slong Qlen, slong n, slong prec)
 {
-    slong i, k, a[FLINT_BITS];
+    slong i, k, h, a[FLINT_BITS];
     arb_ptr T, U, V;
 
     if (n <= 2)
@@ -57,14 +57,17 @@ _arb_poly_revert_series_newton(arb_ptr Qinv, arb_srcptr Q, slong Qlen, slong n,
 
     for (i--; i >= 0; i--)
     {
+        h = k;
         k = a[i];
         _arb_poly_compose_series(T, Q, FLINT_MIN(Qlen, k), Qinv, k, k, prec);
         _arb_poly_derivative(U, T, k, prec); arb_zero(U + k - 1);
-        arb_zero(T + 1);
-        _arb_poly_div_series(V, T, k, U, k, k, prec);
+
+        /* Q(Qinv) = x + O(x^h), so the correction V Qinv' = O(x^h) and
+           only its coefficients h, ..., k - 1 need to be computed */
+        _arb_poly_div_series(V, T + h, k - h, U, k - h, k - h, prec);
         _arb_poly_derivative(T, Qinv, k, prec);
-        _arb_poly_mullow(U, V, k, T, k, k, prec);
-        _arb_vec_sub(Qinv, Qinv, U, k, prec);
+        _arb_poly_mullow(U, V, k - h, T, k - h, k - h, prec);
+        _arb_vec_sub(Qinv + h, Qinv + h, U, k - h, prec);
     }
 
     _arb_vec_clear(T, n);
@@ -30,8 +30,7 @@ _arb_poly_sin_cos_series_basecase(arb_ptr s, arb_ptr c, arb_srcptr h, slong hlen
         slong n, slong prec, int times_pi)
 {
     slong j, k, alen = FLINT_MIN(n, hlen);
-    arb_ptr a;
-    arb_t t, u;
+    arb_ptr a, t, u;
 
     if (times_pi)
         arb_sin_cos_pi(s, c, h, prec);
@@ -45,9 +44,10 @@ _arb_poly_sin_cos_series_basecase(arb_ptr s, arb_ptr c, arb_srcptr h, slong hlen
         return;
     }
 
-    arb_init(t);
-    arb_init(u);
-    a = _arb_vec_init(alen);
+    arb_scratch_begin();
+    t = arb_scratch_vec(alen + 2);
+    u = t + 1;
+    a = t + 2;
 
     for (k = 1; k < alen; k++)
         arb_mul_ui(a + k, h + k, k, prec);
@@ -73,9 +73,7 @@ _arb_poly_sin_cos_series_basecase(arb_ptr s, arb_ptr c, arb_srcptr h, slong hlen
         arb_div_ui(s + k, u, k, prec);
     }
 
-    arb_clear(t);
-    arb_clear(u);
-    _arb_vec_clear(a, alen);
+    arb_scratch_end();
 }
 
 void
@@ -0,0 +1,182 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mulhigh....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with fmpq_poly */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        slong qbits1, qbits2, rbits1, rbits2, rbits3, nlo;
+        fmpq_poly_t A, B, C;
+        arb_poly_t a, b, c, d;
+
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 200);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+        nlo = n_randint(state, 100);
+
+        fmpq_poly_init(A);
+        fmpq_poly_init(B);
+        fmpq_poly_init(C);
+
+        arb_poly_init(a);
+        arb_poly_init(b);
+        arb_poly_init(c);
+        arb_poly_init(d);
+
+        fmpq_poly_randtest(A, state, 1 + n_randint(state, 50), qbits1);
+        fmpq_poly_randtest(B, state, 1 + n_randint(state, 50), qbits2);
+
+        fmpq_poly_mul(C, A, B);
+        fmpq_poly_shift_right(C, C, nlo);
+
+        arb_poly_set_fmpq_poly(a, A, rbits1);
+        arb_poly_set_fmpq_poly(b, B, rbits2);
+
+        arb_poly_mulhigh(c, a, b, nlo, rbits3);
+
+        if (!arb_poly_contains_fmpq_poly(c, C))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("bits3 = %wd\n", rbits3);
+            flint_printf("nlo = %wd\n", nlo);
+
+            flint_printf("A = "); fmpq_poly_print(A); flint_printf("\n\n");
+            flint_printf("B = "); fmpq_poly_print(B); flint_printf("\n\n");
+            flint_printf("C = "); fmpq_poly_print(C); flint_printf("\n\n");
+
+            flint_printf("a = "); arb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); arb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("c = "); arb_poly_printd(c, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        arb_poly_set(d, a);
+        arb_poly_mulhigh(d, d, b, nlo, rbits3);
+        if (!arb_poly_equal(d, c))
+        {
+            flint_printf("FAIL (aliasing 1)\n\n");
+            abort();
+        }
+
+        arb_poly_set(d, b);
+        arb_poly_mulhigh(d, a, d, nlo, rbits3);
+        if (!arb_poly_equal(d, c))
+        {
+            flint_printf("FAIL (aliasing 2)\n\n");
+            abort();
+        }
+
+        /* test squaring */
+        arb_poly_set(b, a);
+        arb_poly_mulhigh(c, a, b, nlo, rbits3);
+        arb_poly_mulhigh(d, a, a, nlo, rbits3);
+        if (!arb_poly_overlaps(c, d))  /* not guaranteed to be identical */
+        {
+            flint_printf("FAIL (squaring)\n\n");
+
+            flint_printf("a = "); arb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("c = "); arb_poly_printd(c, 15); flint_printf("\n\n");
+            flint_printf("d = "); arb_poly_printd(d, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        arb_poly_mulhigh(a, a, a, nlo, rbits3);
+        if (!arb_poly_equal(d, a))
+        {
+            flint_printf("FAIL (aliasing, squaring)\n\n");
+            abort();
+        }
+
+        fmpq_poly_clear(A);
+        fmpq_poly_clear(B);
+        fmpq_poly_clear(C);
+
+        arb_poly_clear(a);
+        arb_poly_clear(b);
+        arb_poly_clear(c);
+        arb_poly_clear(d);
+    }
+
+    /* compare with mul */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        slong bits, nlo;
+        arb_poly_t a, b, ab, ab2;
+
+        bits = 2 + n_randint(state, 200);
+        nlo = n_randint(state, 100);
+
+        arb_poly_init(a);
+        arb_poly_init(b);
+        arb_poly_init(ab);
+        arb_poly_init(ab2);
+
+        arb_poly_randtest(a, state, 1 + n_randint(state, 50), bits, 5);
+        arb_poly_randtest(b, state, 1 + n_randint(state, 50), bits, 5);
+
+        arb_poly_mul(ab, a, b, bits);
+        arb_poly_shift_right(ab, ab, nlo);
+        arb_poly_mulhigh(ab2, a, b, nlo, bits);
+
+        if (!arb_poly_overlaps(ab, ab2))
+        {
+            flint_printf("FAIL (overlap)\n\n");
+            flint_printf("bits = %wd\n", bits);
+            flint_printf("nlo = %wd\n", nlo);
+
+            flint_printf("a = "); arb_poly_printd(a, 15); flint_printf("\n\n");
+            flint_printf("b = "); arb_poly_printd(b, 15); flint_printf("\n\n");
+            flint_printf("ab = "); arb_poly_printd(ab, 15); flint_printf("\n\n");
+            flint_printf("ab2 = "); arb_poly_printd(ab2, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        arb_poly_clear(a);
+        arb_poly_clear(b);
+        arb_poly_clear(ab);
+        arb_poly_clear(ab2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mullow_block_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* the result must not depend on the number of threads */
+    for (iter = 0; iter < 200; iter++)
+    {
+        slong len1, len2, rbits1, rbits2, rbits3, trunc;
+        arb_poly_t a, b, c, d;
+
+        len1 = 1 + n_randint(state, 1000);
+        len2 = 1 + n_randint(state, 1000);
+        rbits1 = 2 + n_randint(state, 4000);
+        rbits2 = 2 + n_randint(state, 4000);
+        rbits3 = 2 + n_randint(state, 4000);
+        trunc = n_randint(state, len1 + len2);
+
+        arb_poly_init(a);
+        arb_poly_init(b);
+        arb_poly_init(c);
+        arb_poly_init(d);
+
+        arb_poly_randtest(a, state, len1, rbits1, 1 + n_randint(state, 100));
+        arb_poly_randtest(b, state, len2, rbits2, 1 + n_randint(state, 100));
+
+        if (n_randint(state, 4) == 0)
+        {
+            slong i;
+
+            for (i = 0; i < a->length; i++)
+                mag_zero(arb_radref(a->coeffs + i));
+        }
+
+        flint_set_num_threads(1);
+        arb_poly_mullow_block(c, a, b, trunc, rbits3);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_poly_mullow_block(d, a, b, trunc, rbits3);
+
+        if (!arb_poly_equal(c, d))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("threads = %d, len1 = %wd, len2 = %wd, bits3 = %wd, trunc = %wd\n",
+                flint_get_num_threads(), len1, len2, rbits3, trunc);
+
+            flint_printf("c = "); arb_poly_printd(c, 15); flint_printf("\n\n");
+            flint_printf("d = "); arb_poly_printd(d, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        /* test squaring */
+        flint_set_num_threads(1);
+        arb_poly_mullow_block(c, a, a, trunc, rbits3);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_poly_mullow_block(d, a, a, trunc, rbits3);
+
+        if (!arb_poly_equal(c, d))
+        {
+            flint_printf("FAIL (squaring)\n\n");
+            flint_printf("threads = %d, len1 = %wd, bits3 = %wd, trunc = %wd\n",
+                flint_get_num_threads(), len1, rbits3, trunc);
+
+            flint_printf("c = "); arb_poly_printd(c, 15); flint_printf("\n\n");
+            flint_printf("d = "); arb_poly_printd(d, 15); flint_printf("\n\n");
+
+            abort();
+        }
+
+        arb_poly_clear(a);
+        arb_poly_clear(b);
+        arb_poly_clear(c);
+        arb_poly_clear(d);
+    }
+
+    flint_set_num_threads(1);
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,209 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_poly.h"
+
+static int
+_vec_equal(arb_srcptr x, arb_srcptr y, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        if (!arb_equal(x + i, y + i))
+            return 0;
+
+    return 1;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("nodes....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 3000; iter++)
+    {
+        slong i, n, num, qbits1, qbits2, rbits1, rbits2, rbits3;
+        fmpq_poly_t P;
+        arb_poly_t R, S;
+        arb_poly_struct * polys;
+        fmpq_t t, u, v;
+        arb_ptr xs, ys, zs;
+        arb_t x, y;
+        arb_poly_nodes_t T;
+
+        fmpq_poly_init(P);
+        arb_poly_init(R);
+        arb_poly_init(S);
+        fmpq_init(t);
+        fmpq_init(u);
+        fmpq_init(v);
+        arb_init(x);
+        arb_init(y);
+
+        qbits1 = 2 + n_randint(state, 200);
+        qbits2 = 2 + n_randint(state, 5);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+
+        fmpq_poly_randtest(P, state, 1 + n_randint(state, 30), qbits1);
+        n = P->length;
+
+        xs = _arb_vec_init(n);
+        ys = _arb_vec_init(n);
+        zs = _arb_vec_init(n);
+
+        arb_poly_set_fmpq_poly(R, P, rbits1);
+
+        if (n > 0)
+        {
+            fmpq_randtest(t, state, qbits2);
+            arb_set_fmpq(xs, t, rbits2);
+
+            for (i = 1; i < n; i++)
+            {
+                fmpq_randtest_not_zero(u, state, qbits2);
+                fmpq_abs(u, u);
+                fmpq_add(t, t, u);
+                arb_set_fmpq(xs + i, t, rbits2);
+            }
+        }
+
+        arb_poly_nodes_init(T, xs, n, rbits3);
+
+        if (arb_poly_nodes_length(T) != n)
+        {
+            flint_printf("FAIL (length)\n\n");
+            abort();
+        }
+
+        /* evaluation */
+        arb_poly_nodes_evaluate_vec(ys, R, T, rbits3);
+        arb_poly_evaluate_vec_fast(zs, R, xs, n, rbits3);
+
+        if (!_vec_equal(ys, zs, n))
+        {
+            flint_printf("FAIL (evaluate_vec)\n\n");
+            flint_printf("R = "); arb_poly_printd(R, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        /* interpolation */
+        for (i = 0; i < n; i++)
+            arb_poly_evaluate(ys + i, R, xs + i, rbits2);
+
+        arb_poly_nodes_interpolate(S, ys, T, rbits3);
+
+        if (!arb_poly_contains_fmpq_poly(S, P))
+        {
+            flint_printf("FAIL (interpolate)\n\n");
+            flint_printf("P = "); fmpq_poly_print(P); flint_printf("\n\n");
+            flint_printf("S = "); arb_poly_printd(S, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_poly_interpolate_fast(R, xs, ys, n, rbits3);
+
+        if (!arb_poly_equal(R, S))
+        {
+            flint_printf("FAIL (interpolate_fast)\n\n");
+            flint_printf("R = "); arb_poly_printd(R, 15); flint_printf("\n\n");
+            flint_printf("S = "); arb_poly_printd(S, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        /* evaluation of the interpolating polynomial */
+        fmpq_randtest(u, state, qbits2);
+        fmpq_poly_evaluate_fmpq(v, P, u);
+        arb_set_fmpq(x, u, rbits2);
+        arb_poly_nodes_evaluate_interpolant(y, ys, T, x, rbits3);
+
+        if (!arb_contains_fmpq(y, v))
+        {
+            flint_printf("FAIL (evaluate_interpolant)\n\n");
+            flint_printf("P = "); fmpq_poly_print(P); flint_printf("\n\n");
+            flint_printf("u = "); fmpq_print(u); flint_printf("\n\n");
+            flint_printf("y = "); arb_printd(y, 15); flint_printf("\n\n");
+            abort();
+        }
+
+        /* batch evaluation */
+        num = n_randint(state, 6);
+        polys = flint_malloc(sizeof(arb_poly_struct) * num);
+        _arb_vec_clear(zs, n);
+        zs = _arb_vec_init(num * n);
+
+        for (i = 0; i < num; i++)
+        {
+            arb_poly_init(polys + i);
+            arb_poly_randtest(polys + i, state, n_randint(state, 40), rbits1, 10);
+        }
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_poly_nodes_evaluate_vec_batch(zs, polys, num, T, rbits3);
+        flint_set_num_threads(1);
+
+        for (i = 0; i < num; i++)
+        {
+            arb_poly_nodes_evaluate_vec(ys, polys + i, T, rbits3);
+
+            if (!_vec_equal(ys, zs + i * n, n))
+            {
+                flint_printf("FAIL (evaluate_vec_batch)\n\n");
+                flint_printf("i = %wd\n\n", i);
+                abort();
+            }
+        }
+
+        for (i = 0; i < num; i++)
+            arb_poly_clear(polys + i);
+        flint_free(polys);
+
+        arb_poly_nodes_clear(T);
+
+        fmpq_poly_clear(P);
+        arb_poly_clear(R);
+        arb_poly_clear(S);
+        fmpq_clear(t);
+        fmpq_clear(u);
+        fmpq_clear(v);
+        arb_clear(x);
+        arb_clear(y);
+        _arb_vec_clear(xs, n);
+        _arb_vec_clear(ys, n);
+        _arb_vec_clear(zs, num * n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
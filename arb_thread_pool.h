@@ -0,0 +1,70 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#ifndef ARB_THREAD_POOL_H
+#define ARB_THREAD_POOL_H
+
+#include <pthread.h>
+#include "flint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*arb_thread_pool_func_t)(void * arg);
+
+typedef struct arb_thread_pool_group_struct
+{
+    slong pending;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    struct arb_thread_pool_group_struct * parent;
+}
+arb_thread_pool_group_struct;
+
+typedef arb_thread_pool_group_struct arb_thread_pool_group_t[1];
+
+void arb_thread_pool_group_init(arb_thread_pool_group_t group);
+
+void arb_thread_pool_group_clear(arb_thread_pool_group_t group);
+
+void arb_thread_pool_submit(arb_thread_pool_group_t group,
+    arb_thread_pool_func_t func, void * arg);
+
+void arb_thread_pool_wait(arb_thread_pool_group_t group);
+
+void arb_thread_pool_run(arb_thread_pool_func_t func,
+    void * args, size_t size, slong num);
+
+slong arb_thread_pool_num_workers(void);
+
+void arb_thread_pool_cleanup(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,442 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_thread_pool.h"
+
+/*
+    Each worker owns a deque of tasks. Tasks submitted from a worker are
+    pushed onto the bottom of its own deque and popped from there (LIFO,
+    which keeps nested work local), while idle workers steal from the top
+    of the other deques (FIFO). Tasks submitted from outside the pool are
+    distributed round-robin.
+
+    A thread waiting for a group executes queued tasks until the group is
+    done, but only tasks of that group and of groups created while running
+    them (its descendants). Running an unrelated task there could make the
+    waiting thread block on a lock or condition that is held further up its
+    own stack, which would never be released.
+
+    Workers persist between calls, so their thread-local caches survive;
+    they only call flint_cleanup() when the pool is shut down.
+*/
+
+typedef struct
+{
+    arb_thread_pool_func_t func;
+    void * arg;
+    arb_thread_pool_group_struct * group;
+}
+task_struct;
+
+typedef struct
+{
+    task_struct * tasks;
+    slong head;
+    slong num;
+    slong alloc;
+    pthread_mutex_t mutex;
+}
+deque_struct;
+
+/* protects starting and stopping the pool, and active_groups */
+static pthread_mutex_t pool_init_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* protects num_queued, next and shutdown */
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+
+static slong pool_num_workers = 0;
+static slong pool_active_groups = 0;
+static pthread_t * pool_threads = NULL;
+static deque_struct * pool_deques = NULL;
+static slong pool_num_queued = 0;
+static ulong pool_next = 0;
+static int pool_shutdown = 0;
+
+static FLINT_TLS_PREFIX slong pool_self = -1;
+static FLINT_TLS_PREFIX arb_thread_pool_group_struct * pool_current = NULL;
+static FLINT_TLS_PREFIX int pool_have_registered_cleanup = 0;
+
+static void
+deque_push(deque_struct * d, const task_struct * task)
+{
+    pthread_mutex_lock(&d->mutex);
+
+    if (d->num == d->alloc)
+    {
+        slong i, new_alloc;
+        task_struct * tmp;
+
+        new_alloc = FLINT_MAX(16, 2 * d->alloc);
+        tmp = flint_malloc(sizeof(task_struct) * new_alloc);
+
+        for (i = 0; i < d->num; i++)
+            tmp[i] = d->tasks[(d->head + i) % d->alloc];
+
+        flint_free(d->tasks);
+        d->tasks = tmp;
+        d->head = 0;
+        d->alloc = new_alloc;
+    }
+
+    d->tasks[(d->head + d->num) % d->alloc] = *task;
+    d->num++;
+
+    pthread_mutex_unlock(&d->mutex);
+}
+
+/* whether group is ancestor or one of its descendants */
+static int
+group_is_within(const arb_thread_pool_group_struct * group,
+    const arb_thread_pool_group_struct * ancestor)
+{
+    for ( ; group != NULL; group = group->parent)
+        if (group == ancestor)
+            return 1;
+
+    return 0;
+}
+
+/* removes the task nearest to the bottom (or top) of the deque which
+   belongs to within, or to any group if within is NULL */
+static int
+deque_take(task_struct * task, deque_struct * d,
+    const arb_thread_pool_group_struct * within, int bottom)
+{
+    slong i, j;
+    int found = 0;
+
+    pthread_mutex_lock(&d->mutex);
+
+    for (i = 0; i < d->num && !found; i++)
+    {
+        j = bottom ? d->num - 1 - i : i;
+
+        if (within == NULL ||
+            group_is_within(d->tasks[(d->head + j) % d->alloc].group, within))
+        {
+            *task = d->tasks[(d->head + j) % d->alloc];
+            found = 1;
+
+            if (j == 0)
+            {
+                d->head = (d->head + 1) % d->alloc;
+            }
+            else
+            {
+                for ( ; j < d->num - 1; j++)
+                    d->tasks[(d->head + j) % d->alloc] =
+                        d->tasks[(d->head + j + 1) % d->alloc];
+            }
+
+            d->num--;
+        }
+    }
+
+    pthread_mutex_unlock(&d->mutex);
+
+    return found;
+}
+
+static int
+take_task(task_struct * task, const arb_thread_pool_group_struct * within)
+{
+    slong i, n, start;
+    int found;
+
+    n = pool_num_workers;
+    found = 0;
+
+    if (pool_self >= 0)
+    {
+        found = deque_take(task, pool_deques + pool_self, within, 1);
+        start = pool_self + 1;
+    }
+    else
+    {
+        start = 0;
+    }
+
+    for (i = 0; i < n && !found; i++)
+        found = deque_take(task, pool_deques + ((start + i) % n), within, 0);
+
+    if (found)
+    {
+        pthread_mutex_lock(&pool_mutex);
+        pool_num_queued--;
+        pthread_mutex_unlock(&pool_mutex);
+    }
+
+    return found;
+}
+
+static void
+run_task(const task_struct * task)
+{
+    arb_thread_pool_group_struct * group = task->group;
+    arb_thread_pool_group_struct * outer = pool_current;
+
+    /* groups created by the task become descendants of its group */
+    pool_current = group;
+    task->func(task->arg);
+    pool_current = outer;
+
+    pthread_mutex_lock(&group->mutex);
+    group->pending--;
+    if (group->pending == 0)
+        pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->mutex);
+}
+
+static void *
+worker(void * arg_ptr)
+{
+    task_struct task;
+
+    pool_self = ((deque_struct *) arg_ptr) - pool_deques;
+
+    while (1)
+    {
+        if (take_task(&task, NULL))
+        {
+            run_task(&task);
+        }
+        else
+        {
+            int stop;
+
+            pthread_mutex_lock(&pool_mutex);
+            while (pool_num_queued == 0 && !pool_shutdown)
+                pthread_cond_wait(&pool_cond, &pool_mutex);
+            stop = pool_shutdown && (pool_num_queued == 0);
+            pthread_mutex_unlock(&pool_mutex);
+
+            if (stop)
+                break;
+        }
+    }
+
+    pool_self = -1;
+    flint_cleanup();
+    return NULL;
+}
+
+/* must be called with pool_init_mutex held */
+static void
+pool_stop(void)
+{
+    slong i;
+
+    if (pool_num_workers == 0)
+        return;
+
+    pthread_mutex_lock(&pool_mutex);
+    pool_shutdown = 1;
+    pthread_cond_broadcast(&pool_cond);
+    pthread_mutex_unlock(&pool_mutex);
+
+    for (i = 0; i < pool_num_workers; i++)
+        pthread_join(pool_threads[i], NULL);
+
+    for (i = 0; i < pool_num_workers; i++)
+    {
+        flint_free(pool_deques[i].tasks);
+        pthread_mutex_destroy(&pool_deques[i].mutex);
+    }
+
+    flint_free(pool_threads);
+    flint_free(pool_deques);
+
+    pool_threads = NULL;
+    pool_deques = NULL;
+    pool_num_workers = 0;
+    pool_num_queued = 0;
+    pool_shutdown = 0;
+}
+
+/* must be called with pool_init_mutex held */
+static void
+pool_start(slong num_workers)
+{
+    slong i;
+
+    pool_threads = flint_malloc(sizeof(pthread_t) * num_workers);
+    pool_deques = flint_malloc(sizeof(deque_struct) * num_workers);
+
+    for (i = 0; i < num_workers; i++)
+    {
+        pool_deques[i].tasks = NULL;
+        pool_deques[i].head = 0;
+        pool_deques[i].num = 0;
+        pool_deques[i].alloc = 0;
+        pthread_mutex_init(&pool_deques[i].mutex, NULL);
+    }
+
+    pool_num_workers = num_workers;
+
+    for (i = 0; i < num_workers; i++)
+        pthread_create(pool_threads + i, NULL, worker, pool_deques + i);
+
+    if (!pool_have_registered_cleanup)
+    {
+        flint_register_cleanup_function(arb_thread_pool_cleanup);
+        pool_have_registered_cleanup = 1;
+    }
+}
+
+void
+arb_thread_pool_group_init(arb_thread_pool_group_t group)
+{
+    slong want;
+
+    group->pending = 0;
+    group->parent = pool_current;
+    pthread_mutex_init(&group->mutex, NULL);
+    pthread_cond_init(&group->cond, NULL);
+
+    /* the calling thread also executes tasks, hence the - 1 */
+    want = flint_get_num_threads() - 1;
+
+    pthread_mutex_lock(&pool_init_mutex);
+
+    /* the pool is only resized while nobody is using it */
+    if (pool_active_groups == 0 && want > pool_num_workers)
+    {
+        pool_stop();
+        pool_start(want);
+    }
+
+    pool_active_groups++;
+
+    pthread_mutex_unlock(&pool_init_mutex);
+}
+
+void
+arb_thread_pool_group_clear(arb_thread_pool_group_t group)
+{
+    pthread_mutex_lock(&pool_init_mutex);
+    pool_active_groups--;
+    pthread_mutex_unlock(&pool_init_mutex);
+
+    pthread_mutex_destroy(&group->mutex);
+    pthread_cond_destroy(&group->cond);
+}
+
+void
+arb_thread_pool_submit(arb_thread_pool_group_t group,
+    arb_thread_pool_func_t func, void * arg)
+{
+    task_struct task;
+    slong i;
+
+    /* no workers: run immediately in the calling thread */
+    if (pool_num_workers == 0)
+    {
+        func(arg);
+        return;
+    }
+
+    task.func = func;
+    task.arg = arg;
+    task.group = group;
+
+    pthread_mutex_lock(&group->mutex);
+    group->pending++;
+    pthread_mutex_unlock(&group->mutex);
+
+    if (pool_self >= 0)
+    {
+        i = pool_self;
+    }
+    else
+    {
+        pthread_mutex_lock(&pool_mutex);
+        i = pool_next % pool_num_workers;
+        pool_next++;
+        pthread_mutex_unlock(&pool_mutex);
+    }
+
+    deque_push(pool_deques + i, &task);
+
+    pthread_mutex_lock(&pool_mutex);
+    pool_num_queued++;
+    pthread_cond_signal(&pool_cond);
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+void
+arb_thread_pool_wait(arb_thread_pool_group_t group)
+{
+    task_struct task;
+    slong pending;
+
+    while (1)
+    {
+        pthread_mutex_lock(&group->mutex);
+        pending = group->pending;
+        pthread_mutex_unlock(&group->mutex);
+
+        if (pending == 0)
+            break;
+
+        if (take_task(&task, group))
+        {
+            run_task(&task);
+        }
+        else
+        {
+            /* everything left in the group is running on other threads,
+               which also take care of any tasks they submit */
+            pthread_mutex_lock(&group->mutex);
+            while (group->pending != 0)
+                pthread_cond_wait(&group->cond, &group->mutex);
+            pthread_mutex_unlock(&group->mutex);
+        }
+    }
+}
+
+slong
+arb_thread_pool_num_workers(void)
+{
+    slong n;
+
+    pthread_mutex_lock(&pool_init_mutex);
+    n = pool_num_workers;
+    pthread_mutex_unlock(&pool_init_mutex);
+
+    return n;
+}
+
+void
+arb_thread_pool_cleanup(void)
+{
+    pthread_mutex_lock(&pool_init_mutex);
+
+    if (pool_active_groups == 0)
+        pool_stop();
+
+    pthread_mutex_unlock(&pool_init_mutex);
+}
+
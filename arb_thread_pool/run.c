@@ -0,0 +1,55 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_thread_pool.h"
+
+void
+arb_thread_pool_run(arb_thread_pool_func_t func,
+    void * args, size_t size, slong num)
+{
+    arb_thread_pool_group_t group;
+    slong i;
+
+    if (num <= 0)
+        return;
+
+    if (num == 1)
+    {
+        func(args);
+        return;
+    }
+
+    arb_thread_pool_group_init(group);
+
+    for (i = 1; i < num; i++)
+        arb_thread_pool_submit(group, func, ((char *) args) + i * size);
+
+    /* the calling thread takes the first task itself */
+    func(args);
+
+    arb_thread_pool_wait(group);
+    arb_thread_pool_group_clear(group);
+}
+
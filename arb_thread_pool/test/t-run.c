@@ -0,0 +1,161 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_thread_pool.h"
+
+typedef struct
+{
+    ulong start;
+    ulong len;
+    ulong result;
+    int nested;
+    int locked;
+}
+sum_arg_t;
+
+/* held by a task across a nested wait; a thread waiting inside such a
+   task must not pick up a sibling task which takes the lock again */
+static pthread_mutex_t sum_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void
+sum_worker(void * arg_ptr)
+{
+    sum_arg_t * arg = (sum_arg_t *) arg_ptr;
+    ulong i;
+
+    if (arg->locked)
+        pthread_mutex_lock(&sum_lock);
+
+    if (arg->nested && arg->len >= 2)
+    {
+        /* split in two and run both halves through a group */
+        arb_thread_pool_group_t group;
+        sum_arg_t sub[2];
+
+        sub[0].start = arg->start;
+        sub[0].len = arg->len / 2;
+        sub[0].nested = 1;
+        sub[0].locked = 0;
+        sub[1].start = arg->start + arg->len / 2;
+        sub[1].len = arg->len - arg->len / 2;
+        sub[1].nested = 1;
+        sub[1].locked = 0;
+
+        arb_thread_pool_group_init(group);
+        arb_thread_pool_submit(group, sum_worker, sub + 0);
+        arb_thread_pool_submit(group, sum_worker, sub + 1);
+        arb_thread_pool_wait(group);
+        arb_thread_pool_group_clear(group);
+
+        arg->result = sub[0].result + sub[1].result;
+    }
+    else
+    {
+        arg->result = 0;
+        for (i = 0; i < arg->len; i++)
+            arg->result += (arg->start + i) * (arg->start + i);
+    }
+
+    if (arg->locked)
+        pthread_mutex_unlock(&sum_lock);
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("run....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        slong i, num;
+        ulong len, total, expected;
+        sum_arg_t * args;
+
+        flint_set_num_threads(1 + n_randint(state, 6));
+
+        /* occasionally shut the pool down to test restarting it */
+        if (n_randint(state, 20) == 0)
+            arb_thread_pool_cleanup();
+
+        num = n_randint(state, 20);
+        len = n_randint(state, 200);
+
+        args = flint_malloc(sizeof(sum_arg_t) * FLINT_MAX(num, 1));
+
+        for (i = 0; i < num; i++)
+        {
+            args[i].start = i * len;
+            args[i].len = len;
+            args[i].nested = n_randint(state, 2);
+            args[i].locked = (iter % 2) && n_randint(state, 2);
+        }
+
+        arb_thread_pool_run(sum_worker, args, sizeof(sum_arg_t), num);
+
+        total = 0;
+        for (i = 0; i < num; i++)
+            total += args[i].result;
+
+        expected = 0;
+        for (i = 0; i < num * len; i++)
+            expected += ((ulong) i) * ((ulong) i);
+
+        if (total != expected)
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("threads = %d, num = %wd, len = %wu\n",
+                flint_get_num_threads(), num, len);
+            flint_printf("total = %wu, expected = %wu\n", total, expected);
+            abort();
+        }
+
+        /* the pool never has more workers than threads requested */
+        if (arb_thread_pool_num_workers() > 5)
+        {
+            flint_printf("FAIL (num_workers)\n\n");
+            abort();
+        }
+
+        flint_free(args);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+
+    if (arb_thread_pool_num_workers() != 0)
+    {
+        flint_printf("FAIL (cleanup)\n\n");
+        abort();
+    }
+
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
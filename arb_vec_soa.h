@@ -0,0 +1,179 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#ifndef ARB_VEC_SOA_H
+#define ARB_VEC_SOA_H
+
+#ifdef ARB_VEC_SOA_INLINES_C
+#define ARB_VEC_SOA_INLINE
+#else
+#define ARB_VEC_SOA_INLINE static __inline__
+#endif
+
+#include "arb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    A vector of balls stored as separate arrays. The midpoint of entry i
+    has exponent exp[i] and the ARF_XSIZE-encoded limb count and sign
+    size[i]; its limbs are stored (least significant first, as in an arf_t)
+    in limbs[i * stride], ..., limbs[i * stride + stride - 1], and its
+    radius is rad[i]. The stride is at least ARF_NOPTR_LIMBS and grows
+    when a wider midpoint is stored.
+
+    Entries whose midpoints are special (other than zero) or have huge
+    exponents cannot be represented this way. Such an entry has size
+    ARB_VEC_SOA_SPILL and a zero radius, and its value is kept in the
+    separately allocated ball spill[i]. The spill array is allocated
+    the first time it is needed.
+*/
+typedef struct
+{
+    slong * exp;
+    mp_size_t * size;
+    mp_ptr limbs;
+    mag_ptr rad;
+    arb_ptr * spill;
+    slong len;
+    slong stride;
+    slong nspill;
+}
+arb_vec_soa_struct;
+
+typedef arb_vec_soa_struct arb_vec_soa_t[1];
+
+#define ARB_VEC_SOA_SPILL ((mp_size_t) -1)
+
+#define arb_vec_soa_length(v) ((v)->len)
+
+void arb_vec_soa_init(arb_vec_soa_t v, slong len, slong prec);
+
+void arb_vec_soa_clear(arb_vec_soa_t v);
+
+void arb_vec_soa_zero(arb_vec_soa_t v);
+
+void _arb_vec_soa_fit_stride(arb_vec_soa_t v, slong stride);
+
+void _arb_vec_soa_set_arf_mag(arb_vec_soa_t v, slong i,
+    const arf_t mid, const mag_t rad);
+
+/* Sets t to a read-only shallow copy of the midpoint of entry i, which
+   must not be spilled. */
+ARB_VEC_SOA_INLINE void
+_arb_vec_soa_get_arf_shallow(arf_t t, const arb_vec_soa_t v, slong i)
+{
+    mp_srcptr d;
+    mp_size_t n;
+
+    d = v->limbs + i * v->stride;
+    n = v->size[i] >> 1;
+
+    ARF_EXP(t) = v->exp[i];
+    ARF_XSIZE(t) = v->size[i];
+
+    if (n <= ARF_NOPTR_LIMBS)
+    {
+        ARF_NOPTR_D(t)[0] = d[0];
+        ARF_NOPTR_D(t)[1] = d[1];
+    }
+    else
+    {
+        ARF_PTR_D(t) = (mp_ptr) d;
+        ARF_PTR_ALLOC(t) = n;
+    }
+}
+
+/* Sets t to a read-only shallow copy of entry i. */
+ARB_VEC_SOA_INLINE void
+_arb_vec_soa_get_arb_shallow(arb_t t, const arb_vec_soa_t v, slong i)
+{
+    if (v->size[i] == ARB_VEC_SOA_SPILL)
+    {
+        *t = *v->spill[i];
+    }
+    else
+    {
+        _arb_vec_soa_get_arf_shallow(arb_midref(t), v, i);
+        *arb_radref(t) = v->rad[i];
+    }
+}
+
+/* Sets r, which must not have an mpz exponent, to an upper bound for the
+   absolute value of the midpoint of entry i, which must not be spilled.
+   This gives the same result as mag_fast_init_set_arf. */
+ARB_VEC_SOA_INLINE void
+_arb_vec_soa_get_mag_mid(mag_t r, const arb_vec_soa_t v, slong i)
+{
+    mp_size_t n = v->size[i] >> 1;
+
+    if (n == 0)
+    {
+        MAG_EXP(r) = 0;
+        MAG_MAN(r) = 0;
+    }
+    else
+    {
+        MAG_MAN(r) = (v->limbs[i * v->stride + n - 1]
+            >> (FLINT_BITS - MAG_BITS)) + LIMB_ONE;
+        MAG_EXP(r) = v->exp[i];
+
+        MAG_FAST_ADJUST_ONE_TOO_LARGE(r);
+    }
+}
+
+void arb_vec_soa_set_arb(arb_vec_soa_t v, slong i, const arb_t x, slong prec);
+
+void arb_vec_soa_get_arb(arb_t x, const arb_vec_soa_t v, slong i);
+
+void arb_vec_soa_set_arb_vec(arb_vec_soa_t v, arb_srcptr x, slong prec);
+
+void arb_vec_soa_get_arb_vec(arb_ptr x, const arb_vec_soa_t v);
+
+/* arithmetic */
+
+void arb_vec_soa_add(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec);
+
+void arb_vec_soa_sub(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec);
+
+void arb_vec_soa_mul(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec);
+
+void arb_vec_soa_addmul(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec);
+
+void arb_vec_soa_dot(arb_t res, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
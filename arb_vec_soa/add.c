@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+/* number of radii computed at a time */
+#define RAD_CHUNK 64
+
+static void
+_arb_vec_soa_add_sub(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec, int negate)
+{
+    mag_ptr r;
+    arf_t a, b, t;
+    slong i, k, m, len;
+    int inexact;
+
+    len = x->len;
+
+    if (len == 0)
+        return;
+
+    if (x->nspill != 0 || y->nspill != 0)
+    {
+        arb_t u, v, w;
+        arb_init(w);
+
+        for (i = 0; i < len; i++)
+        {
+            _arb_vec_soa_get_arb_shallow(u, x, i);
+            _arb_vec_soa_get_arb_shallow(v, y, i);
+
+            if (negate)
+                arb_sub(w, u, v, prec);
+            else
+                arb_add(w, u, v, prec);
+
+            _arb_vec_soa_set_arf_mag(z, i, arb_midref(w), arb_radref(w));
+        }
+
+        arb_clear(w);
+        return;
+    }
+
+    r = _mag_vec_init(FLINT_MIN(len, RAD_CHUNK));
+    arf_init(t);
+
+    for (i = 0; i < len; i += m)
+    {
+        m = FLINT_MIN(RAD_CHUNK, len - i);
+
+        _mag_vec_add(r, x->rad + i, y->rad + i, m);
+
+        for (k = 0; k < m; k++)
+        {
+            _arb_vec_soa_get_arf_shallow(a, x, i + k);
+            _arb_vec_soa_get_arf_shallow(b, y, i + k);
+
+            if (ARF_IS_LAGOM(t))
+                inexact = _arf_add_fast(t, a, b, negate, prec, ARB_RND);
+            else if (negate)
+                inexact = arf_sub(t, a, b, prec, ARB_RND);
+            else
+                inexact = arf_add(t, a, b, prec, ARB_RND);
+
+            if (inexact)
+                arf_mag_add_ulp(r + k, r + k, t, prec);
+
+            _arb_vec_soa_set_arf_mag(z, i + k, t, r + k);
+        }
+    }
+
+    arf_clear(t);
+    _mag_vec_clear(r, FLINT_MIN(len, RAD_CHUNK));
+}
+
+void
+arb_vec_soa_add(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec)
+{
+    _arb_vec_soa_add_sub(z, x, y, prec, 0);
+}
+
+void
+arb_vec_soa_sub(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec)
+{
+    _arb_vec_soa_add_sub(z, x, y, prec, 1);
+}
+
@@ -0,0 +1,222 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+#define TMP_ALLOC_LIMBS(size) TMP_ALLOC((size) * sizeof(mp_limb_t))
+
+static void
+_arb_vec_soa_dot_generic(arb_t res, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec)
+{
+    arb_ptr a;
+    slong i, len;
+
+    len = x->len;
+    a = flint_malloc(sizeof(arb_struct) * 2 * len);
+
+    for (i = 0; i < len; i++)
+    {
+        _arb_vec_soa_get_arb_shallow(a + i, x, i);
+        _arb_vec_soa_get_arb_shallow(a + len + i, y, i);
+    }
+
+    arb_dot(res, NULL, 0, a, 1, a + len, 1, len, prec);
+
+    flint_free(a);
+}
+
+/* The same algorithm as arb_dot, reading the midpoints and radii
+   directly from the arrays. */
+void
+arb_vec_soa_dot(arb_t res, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec)
+{
+    slong i, e, max_exp, min_exp, top, bottom, width, padding, err_count, fix;
+    mp_size_t xn, yn, sn, n;
+    mp_srcptr xptr, yptr;
+    mp_ptr sum, tmp, prod;
+    int negative, inexact;
+    mag_t rad, xm, ym;
+    slong len;
+    TMP_INIT;
+
+    len = x->len;
+
+    if (len <= 0)
+    {
+        arb_zero(res);
+        return;
+    }
+
+    if (x->nspill != 0 || y->nspill != 0)
+    {
+        _arb_vec_soa_dot_generic(res, x, y, prec);
+        return;
+    }
+
+    max_exp = WORD_MIN;
+    min_exp = WORD_MAX;
+
+    for (i = 0; i < len; i++)
+    {
+        if (!MAG_IS_LAGOM(x->rad + i) || !MAG_IS_LAGOM(y->rad + i))
+        {
+            _arb_vec_soa_dot_generic(res, x, y, prec);
+            return;
+        }
+
+        xn = x->size[i] >> 1;
+        yn = y->size[i] >> 1;
+
+        if (xn != 0 && yn != 0)
+        {
+            e = x->exp[i] + y->exp[i];
+            max_exp = FLINT_MAX(max_exp, e);
+            e -= (xn + yn) * FLINT_BITS;
+            min_exp = FLINT_MIN(min_exp, e);
+        }
+    }
+
+    mag_fast_zero(rad);
+
+    for (i = 0; i < len; i++)
+    {
+        if (!mag_fast_is_zero(x->rad + i) || !mag_fast_is_zero(y->rad + i))
+        {
+            _arb_vec_soa_get_mag_mid(xm, x, i);
+            _arb_vec_soa_get_mag_mid(ym, y, i);
+
+            mag_fast_addmul(rad, xm, y->rad + i);
+            mag_fast_addmul(rad, ym, x->rad + i);
+            mag_fast_addmul(rad, x->rad + i, y->rad + i);
+        }
+    }
+
+    if (max_exp == WORD_MIN)
+    {
+        arf_zero(arb_midref(res));
+        mag_set(arb_radref(res), rad);
+        return;
+    }
+
+    padding = FLINT_BIT_COUNT(len) + 2;
+    top = max_exp + padding;
+
+    if (prec >= max_exp - min_exp)
+        width = max_exp - min_exp + padding;
+    else
+        width = prec + 2 * FLINT_BITS + padding;
+
+    sn = (width + FLINT_BITS - 1) / FLINT_BITS;
+    bottom = top - sn * FLINT_BITS;
+
+    TMP_START;
+
+    sum = TMP_ALLOC_LIMBS(sn);
+    tmp = TMP_ALLOC_LIMBS(2 * sn + 1);
+    prod = TMP_ALLOC_LIMBS(2 * sn);
+
+    flint_mpn_zero(sum, sn);
+    err_count = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        xn = x->size[i] >> 1;
+        yn = y->size[i] >> 1;
+
+        if (xn == 0 || yn == 0)
+            continue;
+
+        e = x->exp[i] + y->exp[i];
+        negative = (x->size[i] ^ y->size[i]) & 1;
+
+        xptr = x->limbs + i * x->stride;
+        yptr = y->limbs + i * y->stride;
+
+        if (xn > sn)
+        {
+            xptr += xn - sn;
+            xn = sn;
+            err_count++;
+        }
+
+        if (yn > sn)
+        {
+            yptr += yn - sn;
+            yn = sn;
+            err_count++;
+        }
+
+        if (xn == 1 && yn == 1)
+        {
+            umul_ppmm(prod[1], prod[0], xptr[0], yptr[0]);
+        }
+        else if (xn >= yn)
+        {
+            mpn_mul(prod, xptr, xn, yptr, yn);
+        }
+        else
+        {
+            mpn_mul(prod, yptr, yn, xptr, xn);
+        }
+
+        err_count += _arb_dot_add_term(sum, sn, bottom, tmp, prod, xn + yn,
+            e, negative);
+    }
+
+    negative = (sum[sn - 1] >> (FLINT_BITS - 1)) != 0;
+
+    if (negative)
+        mpn_neg(sum, sum, sn);
+
+    n = sn;
+    while (n > 0 && sum[n - 1] == 0)
+        n--;
+
+    if (n == 0)
+    {
+        arf_zero(arb_midref(res));
+        inexact = 0;
+    }
+    else
+    {
+        inexact = _arf_set_round_mpn(arb_midref(res), &fix, sum, n,
+            negative, prec, ARB_RND);
+        _fmpz_demote(ARF_EXPREF(arb_midref(res)));
+        ARF_EXP(arb_midref(res)) = bottom + n * FLINT_BITS + fix;
+    }
+
+    if (err_count != 0)
+        mag_fast_add_2exp_si(rad, rad, bottom + FLINT_BIT_COUNT(err_count));
+
+    if (inexact)
+        arf_mag_fast_add_ulp(rad, rad, arb_midref(res), prec);
+
+    mag_set(arb_radref(res), rad);
+
+    TMP_END;
+}
+
@@ -0,0 +1,60 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+void
+_arb_vec_soa_fit_stride(arb_vec_soa_t v, slong stride)
+{
+    mp_ptr limbs;
+    mp_size_t n;
+    slong i;
+
+    if (stride <= v->stride)
+        return;
+
+    /* grow by at least a factor 1.5 to avoid repeated copying */
+    stride = FLINT_MAX(stride, v->stride + v->stride / 2);
+
+    if (v->len != 0)
+    {
+        limbs = flint_calloc(v->len * stride, sizeof(mp_limb_t));
+
+        for (i = 0; i < v->len; i++)
+        {
+            if (v->size[i] != ARB_VEC_SOA_SPILL)
+            {
+                n = v->size[i] >> 1;
+                flint_mpn_copyi(limbs + i * stride, v->limbs + i * v->stride, n);
+            }
+        }
+
+        flint_free(v->limbs);
+        v->limbs = limbs;
+    }
+
+    v->stride = stride;
+}
+
@@ -0,0 +1,76 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+void
+arb_vec_soa_init(arb_vec_soa_t v, slong len, slong prec)
+{
+    v->len = len;
+    v->stride = FLINT_MAX(ARF_NOPTR_LIMBS, (prec + FLINT_BITS - 1) / FLINT_BITS);
+    v->spill = NULL;
+    v->nspill = 0;
+
+    if (len == 0)
+    {
+        v->exp = NULL;
+        v->size = NULL;
+        v->limbs = NULL;
+        v->rad = NULL;
+    }
+    else
+    {
+        v->exp = flint_calloc(len, sizeof(slong));
+        v->size = flint_calloc(len, sizeof(mp_size_t));
+        v->limbs = flint_calloc(len * v->stride, sizeof(mp_limb_t));
+        v->rad = _mag_vec_init(len);
+    }
+}
+
+void
+arb_vec_soa_clear(arb_vec_soa_t v)
+{
+    slong i;
+
+    if (v->spill != NULL)
+    {
+        for (i = 0; i < v->len; i++)
+        {
+            if (v->spill[i] != NULL)
+                _arb_vec_clear(v->spill[i], 1);
+        }
+
+        flint_free(v->spill);
+    }
+
+    if (v->len != 0)
+    {
+        flint_free(v->exp);
+        flint_free(v->size);
+        flint_free(v->limbs);
+        _mag_vec_clear(v->rad, v->len);
+    }
+}
+
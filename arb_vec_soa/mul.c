@@ -0,0 +1,100 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+/* number of radii computed at a time */
+#define RAD_CHUNK 64
+
+void
+arb_vec_soa_mul(arb_vec_soa_t z, const arb_vec_soa_t x,
+    const arb_vec_soa_t y, slong prec)
+{
+    mag_ptr r, xm, ym;
+    arf_t a, b, t;
+    slong i, k, m, len, alloc;
+    int inexact;
+
+    len = x->len;
+
+    if (len == 0)
+        return;
+
+    if (x->nspill != 0 || y->nspill != 0)
+    {
+        arb_t u, v, w;
+        arb_init(w);
+
+        for (i = 0; i < len; i++)
+        {
+            _arb_vec_soa_get_arb_shallow(u, x, i);
+            _arb_vec_soa_get_arb_shallow(v, y, i);
+            arb_mul(w, u, v, prec);
+            _arb_vec_soa_set_arf_mag(z, i, arb_midref(w), arb_radref(w));
+        }
+
+        arb_clear(w);
+        return;
+    }
+
+    alloc = FLINT_MIN(len, RAD_CHUNK);
+    r = _mag_vec_init(3 * alloc);
+    xm = r + alloc;
+    ym = xm + alloc;
+    arf_init(t);
+
+    for (i = 0; i < len; i += m)
+    {
+        m = FLINT_MIN(RAD_CHUNK, len - i);
+
+        for (k = 0; k < m; k++)
+        {
+            _arb_vec_soa_get_mag_mid(xm + k, x, i + k);
+            _arb_vec_soa_get_mag_mid(ym + k, y, i + k);
+        }
+
+        /* same order of operations as arb_mul */
+        _mag_vec_mul(r, xm, y->rad + i, m);
+        _mag_vec_addmul(r, ym, x->rad + i, m);
+        _mag_vec_addmul(r, x->rad + i, y->rad + i, m);
+
+        for (k = 0; k < m; k++)
+        {
+            _arb_vec_soa_get_arf_shallow(a, x, i + k);
+            _arb_vec_soa_get_arf_shallow(b, y, i + k);
+
+            inexact = arf_mul(t, a, b, prec, ARB_RND);
+
+            if (inexact)
+                arf_mag_add_ulp(r + k, r + k, t, prec);
+
+            _arb_vec_soa_set_arf_mag(z, i + k, t, r + k);
+        }
+    }
+
+    arf_clear(t);
+    _mag_vec_clear(r, 3 * alloc);
+}
+
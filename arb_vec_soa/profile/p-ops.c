@@ -0,0 +1,134 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+#include "profiler.h"
+
+#define LEN 10000
+
+int main()
+{
+    static const slong precs[] = { 64, 256, 1024 };
+    flint_rand_t state;
+    arb_ptr x, y, z;
+    arb_vec_soa_t X, Y, Z;
+    arb_t s;
+    timeit_t t0;
+    slong i, j, k, prec, reps;
+
+    flint_randinit(state);
+    arb_init(s);
+
+    x = _arb_vec_init(LEN);
+    y = _arb_vec_init(LEN);
+    z = _arb_vec_init(LEN);
+
+    arb_vec_soa_init(X, LEN, 64);
+    arb_vec_soa_init(Y, LEN, 64);
+    arb_vec_soa_init(Z, LEN, 64);
+
+    flint_printf("len = %d; times in ms for arb_ptr / arb_vec_soa_t\n\n", LEN);
+
+    for (j = 0; j < 3; j++)
+    {
+        prec = precs[j];
+        reps = 64 * 64 / prec;
+
+        for (i = 0; i < LEN; i++)
+        {
+            arb_randtest(x + i, state, prec, 4);
+            arb_randtest(y + i, state, prec, 4);
+            arb_randtest(z + i, state, prec, 4);
+        }
+
+        arb_vec_soa_set_arb_vec(X, x, prec);
+        arb_vec_soa_set_arb_vec(Y, y, prec);
+        arb_vec_soa_set_arb_vec(Z, z, prec);
+
+        flint_printf("prec = %wd (%wd repetitions)\n", prec, reps);
+
+        flint_printf("    add     ");
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            _arb_vec_add(z, x, y, LEN, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd", t0->cpu);
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            arb_vec_soa_add(Z, X, Y, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd\n", t0->cpu);
+
+        flint_printf("    mul     ");
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            for (i = 0; i < LEN; i++)
+                arb_mul(z + i, x + i, y + i, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd", t0->cpu);
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            arb_vec_soa_mul(Z, X, Y, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd\n", t0->cpu);
+
+        flint_printf("    addmul  ");
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            for (i = 0; i < LEN; i++)
+                arb_addmul(z + i, x + i, y + i, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd", t0->cpu);
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            arb_vec_soa_addmul(Z, X, Y, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd\n", t0->cpu);
+
+        flint_printf("    dot     ");
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            arb_dot(s, NULL, 0, x, 1, y, 1, LEN, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd", t0->cpu);
+        timeit_start(t0);
+        for (k = 0; k < reps; k++)
+            arb_vec_soa_dot(s, X, Y, prec);
+        timeit_stop(t0);
+        flint_printf("%8wd\n\n", t0->cpu);
+    }
+
+    arb_vec_soa_clear(X);
+    arb_vec_soa_clear(Y);
+    arb_vec_soa_clear(Z);
+    _arb_vec_clear(x, LEN);
+    _arb_vec_clear(y, LEN);
+    _arb_vec_clear(z, LEN);
+    arb_clear(s);
+    flint_randclear(state);
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}
+
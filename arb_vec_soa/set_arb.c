@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+void
+arb_vec_soa_set_arb(arb_vec_soa_t v, slong i, const arb_t x, slong prec)
+{
+    if (ARF_SIZE(arb_midref(x)) * FLINT_BITS <= prec)
+    {
+        _arb_vec_soa_set_arf_mag(v, i, arb_midref(x), arb_radref(x));
+    }
+    else
+    {
+        arb_t t;
+        arb_init(t);
+        arb_set_round(t, x, prec);
+        _arb_vec_soa_set_arf_mag(v, i, arb_midref(t), arb_radref(t));
+        arb_clear(t);
+    }
+}
+
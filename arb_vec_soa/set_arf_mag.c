@@ -0,0 +1,82 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+void
+_arb_vec_soa_set_arf_mag(arb_vec_soa_t v, slong i,
+    const arf_t mid, const mag_t rad)
+{
+    mp_srcptr xp;
+    mp_size_t xn;
+
+    if (ARF_IS_LAGOM(mid) && (!arf_is_special(mid) || arf_is_zero(mid)))
+    {
+        if (v->size[i] == ARB_VEC_SOA_SPILL)
+        {
+            _arb_vec_clear(v->spill[i], 1);
+            v->spill[i] = NULL;
+            v->nspill--;
+        }
+
+        xn = ARF_SIZE(mid);
+
+        if (xn != 0)
+        {
+            _arb_vec_soa_fit_stride(v, xn);
+            ARF_GET_MPN_READONLY(xp, xn, mid);
+            flint_mpn_copyi(v->limbs + i * v->stride, xp, xn);
+        }
+
+        v->exp[i] = ARF_EXP(mid);
+        v->size[i] = ARF_XSIZE(mid);
+        mag_set(v->rad + i, rad);
+    }
+    else
+    {
+        if (v->spill == NULL)
+        {
+            slong j;
+
+            v->spill = flint_malloc(sizeof(arb_ptr) * v->len);
+            for (j = 0; j < v->len; j++)
+                v->spill[j] = NULL;
+        }
+
+        if (v->size[i] != ARB_VEC_SOA_SPILL)
+        {
+            v->spill[i] = _arb_vec_init(1);
+            v->nspill++;
+        }
+
+        arf_set(arb_midref(v->spill[i]), mid);
+        mag_set(arb_radref(v->spill[i]), rad);
+
+        v->exp[i] = 0;
+        v->size[i] = ARB_VEC_SOA_SPILL;
+        mag_zero(v->rad + i);
+    }
+}
+
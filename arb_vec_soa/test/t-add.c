@@ -0,0 +1,163 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("add....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        arb_vec_soa_t X, Y, Z;
+        arb_ptr x, y, z, w;
+        slong i, len, prec;
+        int alias, special, negate;
+
+        len = n_randint(state, 100);
+        prec = 2 + n_randint(state, 1000);
+        alias = n_randint(state, 4);
+        special = (n_randint(state, 10) == 0);
+        negate = n_randint(state, 2);
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        z = _arb_vec_init(len);
+        w = _arb_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            if (special)
+            {
+                arb_randtest_special(x + i, state, 1 + n_randint(state, 1000), 100);
+                arb_randtest_special(y + i, state, 1 + n_randint(state, 1000), 100);
+                arb_randtest_special(z + i, state, 1 + n_randint(state, 1000), 100);
+            }
+            else
+            {
+                arb_randtest(x + i, state, 1 + n_randint(state, 1000), 10);
+                arb_randtest(y + i, state, 1 + n_randint(state, 1000), 10);
+                arb_randtest(z + i, state, 1 + n_randint(state, 1000), 10);
+            }
+        }
+
+        if (alias == 3)
+            _arb_vec_set(y, x, len);
+
+        arb_vec_soa_init(X, len, 2 + n_randint(state, 1000));
+        arb_vec_soa_init(Y, len, 2 + n_randint(state, 1000));
+        arb_vec_soa_init(Z, len, 2 + n_randint(state, 1000));
+
+        arb_vec_soa_set_arb_vec(X, x, 1000);
+        arb_vec_soa_set_arb_vec(Y, y, 1000);
+        arb_vec_soa_set_arb_vec(Z, z, 1000);
+
+        for (i = 0; i < len; i++)
+        {
+            if (alias == 1 || alias == 3)
+                arb_set(z + i, x + i);
+            else if (alias == 2)
+                arb_set(z + i, y + i);
+
+            if (negate)
+                arb_sub(z + i, x + i, y + i, prec);
+            else
+                arb_add(z + i, x + i, y + i, prec);
+        }
+
+        if (alias == 0)
+        {
+            if (negate)
+                arb_vec_soa_sub(Z, X, Y, prec);
+            else
+                arb_vec_soa_add(Z, X, Y, prec);
+
+            arb_vec_soa_get_arb_vec(w, Z);
+        }
+        else if (alias == 1)
+        {
+            if (negate)
+                arb_vec_soa_sub(X, X, Y, prec);
+            else
+                arb_vec_soa_add(X, X, Y, prec);
+
+            arb_vec_soa_get_arb_vec(w, X);
+        }
+        else if (alias == 2)
+        {
+            if (negate)
+                arb_vec_soa_sub(Y, X, Y, prec);
+            else
+                arb_vec_soa_add(Y, X, Y, prec);
+
+            arb_vec_soa_get_arb_vec(w, Y);
+        }
+        else
+        {
+            if (negate)
+                arb_vec_soa_sub(X, X, X, prec);
+            else
+                arb_vec_soa_add(X, X, X, prec);
+
+            arb_vec_soa_get_arb_vec(w, X);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            /* infinite radii may be propagated differently */
+            if (!arb_equal(w + i, z + i) &&
+                !(special && arb_contains(w + i, z + i)))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("alias = %d, i = %wd, prec = %wd\n\n", alias, i, prec);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z + i, 30); flint_printf("\n\n");
+                flint_printf("w = "); arb_printd(w + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        arb_vec_soa_clear(X);
+        arb_vec_soa_clear(Y);
+        arb_vec_soa_clear(Z);
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        _arb_vec_clear(z, len);
+        _arb_vec_clear(w, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dot....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        arb_vec_soa_t X, Y;
+        arb_ptr x, y;
+        arb_t s, t;
+        slong i, len, prec, ebits;
+        int special;
+
+        len = n_randint(state, 5);
+        if (n_randint(state, 4) == 0)
+            len += n_randint(state, 100);
+
+        prec = 2 + n_randint(state, 1000);
+        ebits = 1 + n_randint(state, 12);
+        special = (n_randint(state, 10) == 0);
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        arb_init(s);
+        arb_init(t);
+
+        for (i = 0; i < len; i++)
+        {
+            if (special)
+            {
+                arb_randtest_special(x + i, state, 1 + n_randint(state, 1000), 100);
+                arb_randtest_special(y + i, state, 1 + n_randint(state, 1000), 100);
+            }
+            else
+            {
+                arb_randtest(x + i, state, 1 + n_randint(state, 1000), ebits);
+                arb_randtest(y + i, state, 1 + n_randint(state, 1000), ebits);
+            }
+        }
+
+        arb_vec_soa_init(X, len, prec);
+        arb_vec_soa_init(Y, len, prec);
+
+        arb_vec_soa_set_arb_vec(X, x, 1000);
+        arb_vec_soa_set_arb_vec(Y, y, 1000);
+
+        arb_vec_soa_dot(s, X, Y, prec);
+        arb_dot(t, NULL, 0, x, 1, y, 1, len, prec);
+
+        if (!arb_equal(s, t))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("iter = %wd, len = %wd, prec = %wd\n\n", iter, len, prec);
+            flint_printf("s = "); arb_printn(s, 50, ARB_STR_MORE); flint_printf("\n\n");
+            flint_printf("t = "); arb_printn(t, 50, ARB_STR_MORE); flint_printf("\n\n");
+            abort();
+        }
+
+        arb_vec_soa_clear(X);
+        arb_vec_soa_clear(Y);
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        arb_clear(s);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
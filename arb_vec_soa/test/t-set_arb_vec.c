@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("set_arb_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        arb_vec_soa_t v;
+        arb_ptr x, y;
+        arb_t t;
+        slong i, len, prec;
+
+        len = n_randint(state, 30);
+        prec = 2 + n_randint(state, 500);
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        arb_init(t);
+
+        for (i = 0; i < len; i++)
+        {
+            if (n_randint(state, 4) == 0)
+                arb_randtest_special(x + i, state, 1 + n_randint(state, 1000), 100);
+            else
+                arb_randtest(x + i, state, 1 + n_randint(state, 1000), 10);
+        }
+
+        /* start with a narrow stride to test growing it */
+        arb_vec_soa_init(v, len, 2 + n_randint(state, 200));
+
+        /* exact round trip */
+        arb_vec_soa_set_arb_vec(v, x, 1000);
+        arb_vec_soa_get_arb_vec(y, v);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_equal(x + i, y + i))
+            {
+                flint_printf("FAIL (exact)\n\n");
+                flint_printf("i = %wd\n\n", i);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* rounding, overwriting the previous (possibly spilled) entries */
+        arb_vec_soa_set_arb_vec(v, x, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_set_round(t, x + i, prec);
+            arb_vec_soa_get_arb(y + i, v, i);
+
+            if (!arb_equal(t, y + i))
+            {
+                flint_printf("FAIL (rounding)\n\n");
+                flint_printf("i = %wd, prec = %wd\n\n", i, prec);
+                flint_printf("t = "); arb_printd(t, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        if (n_randint(state, 2))
+        {
+            arb_vec_soa_zero(v);
+
+            for (i = 0; i < len; i++)
+            {
+                arb_vec_soa_get_arb(t, v, i);
+
+                if (!arb_is_zero(t))
+                {
+                    flint_printf("FAIL (zero)\n\n");
+                    abort();
+                }
+            }
+        }
+
+        arb_vec_soa_clear(v);
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        arb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,54 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arb_vec_soa.h"
+
+void
+arb_vec_soa_zero(arb_vec_soa_t v)
+{
+    slong i;
+
+    if (v->nspill != 0)
+    {
+        for (i = 0; i < v->len; i++)
+        {
+            if (v->spill[i] != NULL)
+            {
+                _arb_vec_clear(v->spill[i], 1);
+                v->spill[i] = NULL;
+            }
+        }
+
+        v->nspill = 0;
+    }
+
+    for (i = 0; i < v->len; i++)
+    {
+        v->exp[i] = 0;
+        v->size[i] = 0;
+        mag_zero(v->rad + i);
+    }
+}
+
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
     2x2 mul code taken from MPFR 2.3.0
     (Copyright (C) 1991-2007 Free Software Foundation, Inc.)
@@ -181,6 +182,16 @@ void _arf_promote(arf_t x, mp_size_t n);
 
 void _arf_demote(arf_t x);
 
+void arf_cache_set_max(slong num);
+
+slong arf_cache_get_max(void);
+
+slong arf_cache_num_thread(void);
+
+slong arf_cache_num_depot(void);
+
+void arf_cache_trim(void);
+
 
 /* Warning: does not set size! -- also doesn't demote exponent. */
 #define ARF_DEMOTE(x)                 \
@@ -1064,6 +1075,98 @@ int arf_sub_si(arf_ptr z, arf_srcptr x, slong y, slong prec, arf_rnd_t rnd);
 int arf_sub_ui(arf_ptr z, arf_srcptr x, ulong y, slong prec, arf_rnd_t rnd);
 int arf_sub_fmpz(arf_ptr z, arf_srcptr x, const fmpz_t y, slong prec, arf_rnd_t rnd);
 
+/* Sets z to x + y, or x - y if negate is set. Operands with small
+   exponents whose mantissas fit in ARF_NOPTR_LIMBS limbs are added
+   without going through the general code; if the mantissas also have
+   a single limb and overlap, everything is done inline. */
+ARF_INLINE int
+_arf_add_fast(arf_ptr z, arf_srcptr x, arf_srcptr y, int negate,
+    slong prec, arf_rnd_t rnd)
+{
+    mp_size_t xn, yn;
+    slong xexp, yexp, shift, fix;
+    int xsgnbit, ysgnbit, inexact;
+
+    xn = ARF_SIZE(x);
+    yn = ARF_SIZE(y);
+
+    /* special values have size zero */
+    if (xn == 0 || yn == 0 || xn > ARF_NOPTR_LIMBS || yn > ARF_NOPTR_LIMBS
+        || !ARF_IS_LAGOM(x) || !ARF_IS_LAGOM(y))
+    {
+        if (negate)
+            return arf_sub(z, x, y, prec, rnd);
+        else
+            return arf_add(z, x, y, prec, rnd);
+    }
+
+    xexp = ARF_EXP(x);
+    yexp = ARF_EXP(y);
+    xsgnbit = ARF_SGNBIT(x);
+    ysgnbit = ARF_SGNBIT(y) ^ negate;
+
+    if (xexp < yexp)
+    {
+        arf_srcptr __t;
+        mp_size_t __n;
+        slong __e;
+        int __s;
+
+        __t = x; x = y; y = __t;
+        __n = xn; xn = yn; yn = __n;
+        __e = xexp; xexp = yexp; yexp = __e;
+        __s = xsgnbit; xsgnbit = ysgnbit; ysgnbit = __s;
+    }
+
+    shift = xexp - yexp;
+
+    if (xn == 1 && yn == 1 && shift < FLINT_BITS - 1)
+    {
+        mp_limb_t hi, lo, xhi, xlo, yhi, ylo;
+
+        /* leave room for a carry */
+        xhi = ARF_NOPTR_D(x)[0];
+        yhi = ARF_NOPTR_D(y)[0];
+
+        xlo = xhi << (FLINT_BITS - 1);
+        xhi = xhi >> 1;
+
+        ylo = yhi << (FLINT_BITS - (shift + 1));
+        yhi = yhi >> (shift + 1);
+
+        if (xsgnbit == ysgnbit)
+        {
+            add_ssaaaa(hi, lo, xhi, xlo, yhi, ylo);
+        }
+        else if (xhi > yhi || (xhi == yhi && xlo > ylo))
+        {
+            sub_ddmmss(hi, lo, xhi, xlo, yhi, ylo);
+        }
+        else if (xhi != yhi || xlo != ylo)
+        {
+            sub_ddmmss(hi, lo, yhi, ylo, xhi, xlo);
+            xsgnbit = ysgnbit;
+        }
+        else
+        {
+            arf_zero(z);
+            return 0;
+        }
+
+        inexact = _arf_set_round_uiui(z, &fix, hi, lo, xsgnbit, prec, rnd);
+        _fmpz_demote(ARF_EXPREF(z));
+        ARF_EXP(z) = xexp + fix + 1;
+        return inexact;
+    }
+    else
+    {
+        fmpz e = xexp;   /* lagom, hence a small fmpz */
+
+        return _arf_add_mpn(z, ARF_NOPTR_D(x), xn, xsgnbit, &e,
+            ARF_NOPTR_D(y), yn, ysgnbit, shift, prec, rnd);
+    }
+}
+
 int arf_addmul(arf_ptr z, arf_srcptr x, arf_srcptr y, slong prec, arf_rnd_t rnd);
 
 ARF_INLINE int
@@ -20,37 +20,129 @@
 /******************************************************************************
 
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arf.h"
 
-#define ARF_USE_CACHE 0
+#define ARF_USE_CACHE 1
 
 #define ARF_MAX_CACHE_LIMBS 64
 
-FLINT_TLS_PREFIX mp_ptr * arf_free_arr = NULL;
+/*
+    Freed limb arrays of at most ARF_MAX_CACHE_LIMBS limbs are kept in a
+    small per-thread cache of two magazines. When the thread cache is full,
+    one magazine is moved to a global depot shared by all threads, and when
+    it is empty, one magazine is taken back from the depot. The depot holds
+    at most arf_depot_max blocks; anything beyond that is freed. The lock
+    protecting the depot is therefore only taken once per magazine.
+
+    When a thread calls flint_cleanup(), its cache is moved to the depot;
+    the depot itself is freed when the last thread using it cleans up,
+    or by arf_cache_trim().
+*/
+
+#define ARF_MAGAZINE_SIZE 32
+#define ARF_THREAD_CACHE_SIZE (2 * ARF_MAGAZINE_SIZE)
+#define ARF_DEFAULT_DEPOT_MAX 4096
+
+FLINT_TLS_PREFIX mp_ptr arf_free_arr[ARF_THREAD_CACHE_SIZE];
 FLINT_TLS_PREFIX ulong arf_free_num = 0;
-FLINT_TLS_PREFIX ulong arf_free_alloc = 0;
+FLINT_TLS_PREFIX ulong arf_refill_skip = 0;
 FLINT_TLS_PREFIX int arf_have_registered_cleanup = 0;
 
+static pthread_mutex_t arf_depot_mutex = PTHREAD_MUTEX_INITIALIZER;
+static mp_ptr * arf_depot = NULL;
+static slong arf_depot_num = 0;
+static slong arf_depot_alloc = 0;
+static slong arf_depot_max = ARF_DEFAULT_DEPOT_MAX;
+static slong arf_depot_users = 0;
+
+/* must be called with arf_depot_mutex held */
+static void
+_arf_depot_trim(slong num)
+{
+    while (arf_depot_num > num)
+        flint_free(arf_depot[--arf_depot_num]);
+
+    if (arf_depot_num == 0)
+    {
+        flint_free(arf_depot);
+        arf_depot = NULL;
+        arf_depot_alloc = 0;
+    }
+}
+
+/* moves the top num blocks of the thread cache to the depot */
+static void
+_arf_cache_flush(slong num)
+{
+    slong i, keep;
+
+    pthread_mutex_lock(&arf_depot_mutex);
+
+    keep = FLINT_MIN(num, FLINT_MAX(arf_depot_max - arf_depot_num, 0));
+
+    if (arf_depot_num + keep > arf_depot_alloc)
+    {
+        arf_depot_alloc = FLINT_MAX(arf_depot_num + keep, 2 * arf_depot_alloc);
+        arf_depot = flint_realloc(arf_depot, arf_depot_alloc * sizeof(mp_ptr));
+    }
+
+    for (i = 0; i < keep; i++)
+        arf_depot[arf_depot_num++] = arf_free_arr[--arf_free_num];
+
+    pthread_mutex_unlock(&arf_depot_mutex);
+
+    for (i = keep; i < num; i++)
+        flint_free(arf_free_arr[--arf_free_num]);
+}
+
+/* takes up to one magazine from the depot; returns the number of blocks */
+static ulong
+_arf_cache_refill(void)
+{
+    ulong num;
+
+    pthread_mutex_lock(&arf_depot_mutex);
+
+    num = FLINT_MIN(ARF_MAGAZINE_SIZE, arf_depot_num);
+
+    while (arf_free_num < num)
+        arf_free_arr[arf_free_num++] = arf_depot[--arf_depot_num];
+
+    pthread_mutex_unlock(&arf_depot_mutex);
+
+    /* avoid taking the lock on every allocation while the depot is empty */
+    if (num == 0)
+        arf_refill_skip = ARF_MAGAZINE_SIZE;
+
+    return num;
+}
+
 void _arf_cleanup(void)
 {
-    slong i;
-    for (i = 0; i < arf_free_num; i++)
-        flint_free(arf_free_arr[i]);
+    _arf_cache_flush(arf_free_num);
 
-    flint_free(arf_free_arr);
+    pthread_mutex_lock(&arf_depot_mutex);
+    arf_depot_users--;
+    if (arf_depot_users == 0)
+        _arf_depot_trim(0);
+    pthread_mutex_unlock(&arf_depot_mutex);
 
-    arf_free_arr = NULL;
-    arf_free_num = 0;
-    arf_free_alloc = 0;
+    arf_refill_skip = 0;
+    arf_have_registered_cleanup = 0;
 }
 
 void
 _arf_promote(arf_t x, mp_size_t n)
 {
-    if (ARF_USE_CACHE && n <= ARF_MAX_CACHE_LIMBS && arf_free_num != 0)
+    if (ARF_USE_CACHE && n <= ARF_MAX_CACHE_LIMBS &&
+        (arf_free_num != 0 ||
+            ((arf_refill_skip == 0 || --arf_refill_skip == 0) &&
+                _arf_cache_refill() != 0)))
     {
         mp_ptr ptr;
         mp_size_t alloc;
@@ -60,7 +152,7 @@ _arf_promote(arf_t x, mp_size_t n)
 
         if (alloc >= n)
         {
-            ARF_PTR_ALLOC(x) = ptr[0];
+            ARF_PTR_ALLOC(x) = alloc;
             ARF_PTR_D(x) = ptr;
         }
         else
@@ -88,19 +180,19 @@ _arf_demote(arf_t x)
 
     if (ARF_USE_CACHE && alloc <= ARF_MAX_CACHE_LIMBS)
     {
-        if (arf_free_num == arf_free_alloc)
+        if (!arf_have_registered_cleanup)
         {
-            if (!arf_have_registered_cleanup)
-            {
-                flint_register_cleanup_function(_arf_cleanup);
-                arf_have_registered_cleanup = 1;
-            }
-
-            arf_free_alloc = FLINT_MAX(64, arf_free_alloc * 2);
-            arf_free_arr = flint_realloc(arf_free_arr,
-                arf_free_alloc * sizeof(mp_ptr));
+            flint_register_cleanup_function(_arf_cleanup);
+            arf_have_registered_cleanup = 1;
+
+            pthread_mutex_lock(&arf_depot_mutex);
+            arf_depot_users++;
+            pthread_mutex_unlock(&arf_depot_mutex);
         }
 
+        if (arf_free_num == ARF_THREAD_CACHE_SIZE)
+            _arf_cache_flush(ARF_MAGAZINE_SIZE);
+
         ptr[0] = alloc;
         arf_free_arr[arf_free_num++] = ptr;
     }
@@ -110,3 +202,50 @@ _arf_demote(arf_t x)
     }
 }
 
+void
+arf_cache_set_max(slong num)
+{
+    pthread_mutex_lock(&arf_depot_mutex);
+    arf_depot_max = FLINT_MAX(num, 0);
+    if (arf_depot_num > arf_depot_max)
+        _arf_depot_trim(arf_depot_max);
+    pthread_mutex_unlock(&arf_depot_mutex);
+}
+
+slong
+arf_cache_get_max(void)
+{
+    slong num;
+    pthread_mutex_lock(&arf_depot_mutex);
+    num = arf_depot_max;
+    pthread_mutex_unlock(&arf_depot_mutex);
+    return num;
+}
+
+slong
+arf_cache_num_thread(void)
+{
+    return arf_free_num;
+}
+
+slong
+arf_cache_num_depot(void)
+{
+    slong num;
+    pthread_mutex_lock(&arf_depot_mutex);
+    num = arf_depot_num;
+    pthread_mutex_unlock(&arf_depot_mutex);
+    return num;
+}
+
+void
+arf_cache_trim(void)
+{
+    while (arf_free_num != 0)
+        flint_free(arf_free_arr[--arf_free_num]);
+
+    pthread_mutex_lock(&arf_depot_mutex);
+    _arf_depot_trim(0);
+    pthread_mutex_unlock(&arf_depot_mutex);
+}
+
@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "arf.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("add_fast....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        arf_t x, y, z, v;
+        slong prec;
+        int r1, r2, negate, alias;
+        arf_rnd_t rnd;
+
+        arf_init(x);
+        arf_init(y);
+        arf_init(z);
+        arf_init(v);
+
+        /* mostly small mantissas and nearby exponents */
+        if (n_randint(state, 10) == 0)
+        {
+            arf_randtest_special(x, state, 1 + n_randint(state, 300), 1 + n_randint(state, 100));
+            arf_randtest_special(y, state, 1 + n_randint(state, 300), 1 + n_randint(state, 100));
+        }
+        else
+        {
+            arf_randtest(x, state, 1 + n_randint(state, 2 * FLINT_BITS), 1 + n_randint(state, 8));
+            arf_randtest(y, state, 1 + n_randint(state, 2 * FLINT_BITS), 1 + n_randint(state, 8));
+        }
+
+        prec = 2 + n_randint(state, 3 * FLINT_BITS);
+        negate = n_randint(state, 2);
+        alias = n_randint(state, 3);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:  rnd = ARF_RND_DOWN; break;
+            case 1:  rnd = ARF_RND_UP; break;
+            case 2:  rnd = ARF_RND_FLOOR; break;
+            default: rnd = ARF_RND_CEIL; break;
+        }
+
+        if (negate)
+            r2 = arf_sub(v, x, y, prec, rnd);
+        else
+            r2 = arf_add(v, x, y, prec, rnd);
+
+        if (alias == 0)
+        {
+            r1 = _arf_add_fast(z, x, y, negate, prec, rnd);
+        }
+        else if (alias == 1)
+        {
+            arf_set(z, x);
+            r1 = _arf_add_fast(z, z, y, negate, prec, rnd);
+        }
+        else
+        {
+            arf_set(z, y);
+            r1 = _arf_add_fast(z, x, z, negate, prec, rnd);
+        }
+
+        if (!arf_equal(z, v) || r1 != r2)
+        {
+            flint_printf("FAIL!\n");
+            flint_printf("prec = %wd, rnd = %d, negate = %d, alias = %d\n\n",
+                prec, rnd, negate, alias);
+            flint_printf("x = "); arf_print(x); flint_printf("\n\n");
+            flint_printf("y = "); arf_print(y); flint_printf("\n\n");
+            flint_printf("z = "); arf_print(z); flint_printf("\n\n");
+            flint_printf("v = "); arf_print(v); flint_printf("\n\n");
+            flint_printf("r1 = %d, r2 = %d\n", r1, r2);
+            abort();
+        }
+
+        arf_clear(x);
+        arf_clear(y);
+        arf_clear(z);
+        arf_clear(v);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,161 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "arf.h"
+
+#define NUM_THREADS 4
+
+typedef struct
+{
+    slong seed;
+    slong iters;
+}
+work_t;
+
+/* allocates and frees values of various sizes */
+static void
+churn(flint_rand_t state, slong iters)
+{
+    arf_ptr v;
+    slong i, j, len;
+
+    for (i = 0; i < iters; i++)
+    {
+        len = 1 + n_randint(state, 200);
+        v = flint_malloc(sizeof(arf_struct) * len);
+
+        for (j = 0; j < len; j++)
+            arf_init(v + j);
+
+        for (j = 0; j < len; j++)
+            arf_randtest(v + j, state, 1 + n_randint(state, 64 * FLINT_BITS), 10);
+
+        for (j = 0; j < len; j++)
+            arf_mul(v + j, v + j, v + (j + 1) % len, ARF_PREC_EXACT, ARF_RND_DOWN);
+
+        for (j = 0; j < len; j++)
+            arf_clear(v + j);
+
+        flint_free(v);
+    }
+}
+
+static void *
+worker(void * arg_ptr)
+{
+    work_t * arg = (work_t *) arg_ptr;
+    flint_rand_t state;
+
+    flint_randinit(state);
+    state->__randval = arg->seed;
+    state->__randval2 = arg->seed ^ UWORD(0x5555);
+
+    churn(state, arg->iters);
+
+    flint_randclear(state);
+    flint_cleanup();
+    return NULL;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("cache....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 20; iter++)
+    {
+        pthread_t threads[NUM_THREADS];
+        work_t args[NUM_THREADS];
+        slong i, max;
+
+        max = n_randint(state, 3000);
+        arf_cache_set_max(max);
+
+        if (arf_cache_get_max() != max || arf_cache_num_depot() > max)
+        {
+            flint_printf("FAIL (set_max)\n\n");
+            flint_printf("max = %wd, depot = %wd\n", max, arf_cache_num_depot());
+            abort();
+        }
+
+        for (i = 0; i < NUM_THREADS; i++)
+        {
+            args[i].seed = n_randlimb(state);
+            args[i].iters = 50 + n_randint(state, 50);
+            pthread_create(threads + i, NULL, worker, args + i);
+        }
+
+        churn(state, 50);
+
+        for (i = 0; i < NUM_THREADS; i++)
+            pthread_join(threads[i], NULL);
+
+        if (arf_cache_num_depot() > max)
+        {
+            flint_printf("FAIL (depot)\n\n");
+            flint_printf("max = %wd, depot = %wd\n", max, arf_cache_num_depot());
+            abort();
+        }
+
+        if (arf_cache_num_thread() > 64)
+        {
+            flint_printf("FAIL (thread)\n\n");
+            flint_printf("thread = %wd\n", arf_cache_num_thread());
+            abort();
+        }
+
+        if (n_randint(state, 2))
+        {
+            arf_cache_trim();
+
+            if (arf_cache_num_thread() != 0 || arf_cache_num_depot() != 0)
+            {
+                flint_printf("FAIL (trim)\n\n");
+                abort();
+            }
+        }
+    }
+
+    arf_cache_set_max(4096);
+
+    flint_randclear(state);
+    flint_cleanup();
+
+    if (arf_cache_num_thread() != 0 || arf_cache_num_depot() != 0)
+    {
+        flint_printf("FAIL (cleanup)\n\n");
+        abort();
+    }
+
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
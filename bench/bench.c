@@ -0,0 +1,407 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "arb_poly.h"
+#include "arb_mat.h"
+#include "acb_hypgeom.h"
+#include "acb_modular.h"
+
+/*
+    Times the core operations at a range of precisions and prints the
+    results as CSV or JSON. If a baseline file (in the CSV format written
+    by this program) is given, each result is compared with the baseline
+    and the program exits with a nonzero status if any operation has
+    become slower by more than the given tolerance.
+*/
+
+#define MIN_TIME 0.1
+#define POLY_LEN 100
+#define MAT_DIM 20
+
+static const slong precs[] = { 64, 128, 256, 1024, 10000, 100000 };
+
+#define NUM_PRECS (sizeof(precs) / sizeof(slong))
+
+typedef struct
+{
+    slong prec;
+    arf_t x, y, z;
+    arb_t a, b, c, d;
+    acb_t p, q, r, s, t, u, v;
+    arb_ptr f, g, h;
+    arb_mat_t A, B, C;
+}
+bench_data_struct;
+
+typedef bench_data_struct bench_data_t[1];
+
+typedef struct
+{
+    const char * name;
+    void (*func)(bench_data_t);
+}
+bench_struct;
+
+static void
+bench_data_init(bench_data_t D)
+{
+    arf_init(D->x); arf_init(D->y); arf_init(D->z);
+    arb_init(D->a); arb_init(D->b); arb_init(D->c); arb_init(D->d);
+    acb_init(D->p); acb_init(D->q); acb_init(D->r); acb_init(D->s);
+    acb_init(D->t); acb_init(D->u); acb_init(D->v);
+    D->f = _arb_vec_init(POLY_LEN);
+    D->g = _arb_vec_init(POLY_LEN);
+    D->h = _arb_vec_init(POLY_LEN);
+    arb_mat_init(D->A, MAT_DIM, MAT_DIM);
+    arb_mat_init(D->B, MAT_DIM, MAT_DIM);
+    arb_mat_init(D->C, MAT_DIM, MAT_DIM);
+}
+
+static void
+bench_data_clear(bench_data_t D)
+{
+    arf_clear(D->x); arf_clear(D->y); arf_clear(D->z);
+    arb_clear(D->a); arb_clear(D->b); arb_clear(D->c); arb_clear(D->d);
+    acb_clear(D->p); acb_clear(D->q); acb_clear(D->r); acb_clear(D->s);
+    acb_clear(D->t); acb_clear(D->u); acb_clear(D->v);
+    _arb_vec_clear(D->f, POLY_LEN);
+    _arb_vec_clear(D->g, POLY_LEN);
+    _arb_vec_clear(D->h, POLY_LEN);
+    arb_mat_clear(D->A);
+    arb_mat_clear(D->B);
+    arb_mat_clear(D->C);
+}
+
+/* deterministic full-precision inputs */
+static void
+bench_data_set_prec(bench_data_t D, slong prec)
+{
+    slong i, j;
+
+    D->prec = prec;
+
+    arb_sqrt_ui(D->a, 2, prec);
+    arb_sub_ui(D->a, D->a, 1, prec);
+    arb_sqrt_ui(D->b, 3, prec);
+    arb_sub_ui(D->b, D->b, 1, prec);
+
+    arf_set(D->x, arb_midref(D->a));
+    arf_set(D->y, arb_midref(D->b));
+
+    for (i = 0; i < POLY_LEN; i++)
+    {
+        arb_sqrt_ui(D->f + i, 2 * i + 5, prec);
+        arb_sqrt_ui(D->g + i, 3 * i + 7, prec);
+    }
+
+    for (i = 0; i < MAT_DIM; i++)
+    {
+        for (j = 0; j < MAT_DIM; j++)
+        {
+            arb_sqrt_ui(arb_mat_entry(D->A, i, j), i * MAT_DIM + j + 2, prec);
+            arb_sqrt_ui(arb_mat_entry(D->B, i, j), j * MAT_DIM + i + 3, prec);
+        }
+    }
+
+    /* s = 1/2 + 10i for zeta */
+    acb_set_d_d(D->s, 0.5, 10.0);
+
+    /* a = 1/3, b = 1/2 + i/5, c = 3/2, z = 3/10 + i/5 for 2F1 */
+    acb_set_ui(D->p, 1);
+    acb_div_ui(D->p, D->p, 3, prec);
+    arb_set_d(acb_realref(D->q), 0.5);
+    arb_set_ui(acb_imagref(D->q), 1);
+    arb_div_ui(acb_imagref(D->q), acb_imagref(D->q), 5, prec);
+    acb_set_d(D->r, 1.5);
+    acb_set_ui(D->t, 3);
+    acb_div_ui(D->t, D->t, 10, prec);
+    arb_set_ui(acb_imagref(D->t), 1);
+    arb_div_ui(acb_imagref(D->t), acb_imagref(D->t), 5, prec);
+
+    /* z = 1/10 + i/5 and tau = 3/10 + 11i/10 for theta */
+    acb_set_ui(D->u, 1);
+    acb_div_ui(D->u, D->u, 10, prec);
+    arb_set_ui(acb_imagref(D->u), 1);
+    arb_div_ui(acb_imagref(D->u), acb_imagref(D->u), 5, prec);
+    arb_set_ui(acb_realref(D->v), 3);
+    arb_set_ui(acb_imagref(D->v), 11);
+    acb_div_ui(D->v, D->v, 10, prec);
+}
+
+static void b_arf_add(bench_data_t D)
+{
+    arf_add(D->z, D->x, D->y, D->prec, ARF_RND_DOWN);
+}
+
+static void b_arf_mul(bench_data_t D)
+{
+    arf_mul(D->z, D->x, D->y, D->prec, ARF_RND_DOWN);
+}
+
+static void b_arb_mul(bench_data_t D)
+{
+    arb_mul(D->c, D->a, D->b, D->prec);
+}
+
+static void b_arb_exp(bench_data_t D)
+{
+    arb_exp(D->c, D->a, D->prec);
+}
+
+static void b_arb_log(bench_data_t D)
+{
+    arb_log(D->c, D->a, D->prec);
+}
+
+static void b_arb_sin_cos(bench_data_t D)
+{
+    arb_sin_cos(D->c, D->d, D->a, D->prec);
+}
+
+static void b_arb_gamma(bench_data_t D)
+{
+    arb_gamma(D->c, D->a, D->prec);
+}
+
+static void b_acb_zeta(bench_data_t D)
+{
+    acb_zeta(D->t, D->s, D->prec);
+}
+
+static void b_arb_poly_mullow(bench_data_t D)
+{
+    _arb_poly_mullow(D->h, D->f, POLY_LEN, D->g, POLY_LEN, POLY_LEN, D->prec);
+}
+
+static void b_arb_mat_mul(bench_data_t D)
+{
+    arb_mat_mul(D->C, D->A, D->B, D->prec);
+}
+
+static void b_acb_hypgeom_2f1(bench_data_t D)
+{
+    acb_t res;
+    acb_init(res);
+    acb_hypgeom_2f1(res, D->p, D->q, D->r, D->t, 0, D->prec);
+    acb_clear(res);
+}
+
+static void b_acb_modular_theta(bench_data_t D)
+{
+    acb_t t1, t2, t3, t4;
+    acb_init(t1); acb_init(t2); acb_init(t3); acb_init(t4);
+    acb_modular_theta(t1, t2, t3, t4, D->u, D->v, D->prec);
+    acb_clear(t1); acb_clear(t2); acb_clear(t3); acb_clear(t4);
+}
+
+static const bench_struct benchmarks[] =
+{
+    { "arf_add", b_arf_add },
+    { "arf_mul", b_arf_mul },
+    { "arb_mul", b_arb_mul },
+    { "arb_exp", b_arb_exp },
+    { "arb_log", b_arb_log },
+    { "arb_sin_cos", b_arb_sin_cos },
+    { "arb_gamma", b_arb_gamma },
+    { "acb_zeta", b_acb_zeta },
+    { "_arb_poly_mullow", b_arb_poly_mullow },
+    { "arb_mat_mul", b_arb_mat_mul },
+    { "acb_hypgeom_2f1", b_acb_hypgeom_2f1 },
+    { "acb_modular_theta", b_acb_modular_theta },
+};
+
+#define NUM_BENCHMARKS (sizeof(benchmarks) / sizeof(bench_struct))
+
+/* wall-clock time; clock() would add up the time of all threads */
+static double
+wall_time(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+/* seconds per call, after one untimed call to fill any caches */
+static double
+time_benchmark(void (*func)(bench_data_t), bench_data_t D)
+{
+    double t0, t1;
+    slong reps, i;
+
+    func(D);
+
+    for (reps = 1; ; reps *= 2)
+    {
+        t0 = wall_time();
+        for (i = 0; i < reps; i++)
+            func(D);
+        t1 = wall_time();
+
+        if (t1 - t0 >= MIN_TIME)
+            return (t1 - t0) / reps;
+    }
+}
+
+/* looks up name and prec in a baseline file; returns -1 if not found */
+static double
+baseline_time(FILE * fp, const char * name, slong prec)
+{
+    char line[256], bname[64];
+    long bprec;
+    double t;
+
+    rewind(fp);
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        if (sscanf(line, "%63[^,],%ld,%lf", bname, &bprec, &t) == 3 &&
+            strcmp(bname, name) == 0 && bprec == prec)
+            return t;
+    }
+
+    return -1.0;
+}
+
+static void
+usage(void)
+{
+    printf("usage: bench [-json] [-maxprec n] [-only name]"
+        " [-baseline file] [-tolerance percent]\n");
+}
+
+int main(int argc, char * argv[])
+{
+    bench_data_t D;
+    FILE * baseline;
+    const char * only;
+    double t, bt, tolerance;
+    slong i, j, maxprec;
+    int json, first, regressions;
+
+    json = 0;
+    maxprec = WORD_MAX;
+    only = NULL;
+    baseline = NULL;
+    tolerance = 10.0;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-json"))
+        {
+            json = 1;
+        }
+        else if (!strcmp(argv[i], "-maxprec") && i + 1 < argc)
+        {
+            maxprec = atol(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-only") && i + 1 < argc)
+        {
+            only = argv[++i];
+        }
+        else if (!strcmp(argv[i], "-baseline") && i + 1 < argc)
+        {
+            baseline = fopen(argv[++i], "r");
+
+            if (baseline == NULL)
+            {
+                fprintf(stderr, "unable to read %s\n", argv[i]);
+                return 2;
+            }
+        }
+        else if (!strcmp(argv[i], "-tolerance") && i + 1 < argc)
+        {
+            tolerance = atof(argv[++i]);
+        }
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    bench_data_init(D);
+
+    if (json)
+        printf("[\n");
+    else
+        printf("function,prec,seconds\n");
+
+    first = 1;
+    regressions = 0;
+
+    for (j = 0; j < NUM_PRECS && precs[j] <= maxprec; j++)
+    {
+        bench_data_set_prec(D, precs[j]);
+
+        for (i = 0; i < NUM_BENCHMARKS; i++)
+        {
+            if (only != NULL && strcmp(only, benchmarks[i].name))
+                continue;
+
+            t = time_benchmark(benchmarks[i].func, D);
+
+            if (json)
+                printf("%s  {\"function\": \"%s\", \"prec\": %ld, \"seconds\": %.6e}",
+                    first ? "" : ",\n", benchmarks[i].name, (long) precs[j], t);
+            else
+                printf("%s,%ld,%.6e\n", benchmarks[i].name, (long) precs[j], t);
+
+            fflush(stdout);
+            first = 0;
+
+            if (baseline != NULL)
+            {
+                bt = baseline_time(baseline, benchmarks[i].name, precs[j]);
+
+                if (bt > 0.0 && t > bt * (1.0 + tolerance / 100.0))
+                {
+                    fprintf(stderr, "REGRESSION: %s at %ld bits: %.3e s"
+                        " (baseline %.3e s, %+.1f%%)\n", benchmarks[i].name,
+                        (long) precs[j], t, bt, 100.0 * (t / bt - 1.0));
+                    regressions++;
+                }
+            }
+        }
+    }
+
+    if (json)
+        printf("\n]\n");
+
+    if (baseline != NULL)
+    {
+        fprintf(stderr, "%d regression(s) beyond %.1f%%\n",
+            regressions, tolerance);
+        fclose(baseline);
+    }
+
+    bench_data_clear(D);
+    flint_cleanup();
+    return regressions != 0;
+}
@@ -24,6 +24,10 @@
 ******************************************************************************/
 
 #include "bernoulli.h"
+#include "arb_disk_cache.h"
+
+/* tables with fewer entries are neither loaded nor stored on disk */
+#define BERNOULLI_DISK_CACHE_MIN 1024
 
 TLS_PREFIX slong bernoulli_cache_num = 0;
 
@@ -47,7 +51,7 @@ bernoulli_cache_compute(slong n)
 {
     if (bernoulli_cache_num < n)
     {
-        slong i, new_num;
+        slong i, new_num, start;
         bernoulli_rev_t iter;
 
         if (bernoulli_cache_num == 0)
@@ -61,18 +65,30 @@ bernoulli_cache_compute(slong n)
         for (i = bernoulli_cache_num; i < new_num; i++)
             fmpq_init(bernoulli_cache + i);
 
-        i = new_num - 1;
-        i -= (i % 2);
-        bernoulli_rev_init(iter, i);
-        for ( ; i >= bernoulli_cache_num; i -= 2)
+        /* entries found in the disk cache need not be computed */
+        start = bernoulli_cache_num;
+        if (new_num >= BERNOULLI_DISK_CACHE_MIN)
+            start = FLINT_MAX(start, arb_disk_cache_load_fmpq_vec(
+                bernoulli_cache, new_num, "bernoulli"));
+
+        if (start < new_num)
         {
-            bernoulli_rev_next(fmpq_numref(bernoulli_cache + i),
-                fmpq_denref(bernoulli_cache + i), iter);
+            i = new_num - 1;
+            i -= (i % 2);
+            bernoulli_rev_init(iter, i);
+            for ( ; i >= start; i -= 2)
+            {
+                bernoulli_rev_next(fmpq_numref(bernoulli_cache + i),
+                    fmpq_denref(bernoulli_cache + i), iter);
+            }
+            bernoulli_rev_clear(iter);
+
+            if (new_num > 1)
+                fmpq_set_si(bernoulli_cache + 1, -1, 2);
+
+            if (new_num >= BERNOULLI_DISK_CACHE_MIN)
+                arb_disk_cache_save_fmpq_vec(bernoulli_cache, new_num, "bernoulli");
         }
-        bernoulli_rev_clear(iter);
-
-        if (new_num > 1)
-            fmpq_set_si(bernoulli_cache + 1, -1, 2);
 
         bernoulli_cache_num = new_num;
     }
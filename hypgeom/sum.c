@@ -20,10 +20,16 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
 #include "hypgeom.h"
+#include "arb_thread_pool.h"
+#include "arb_instr.h"
+
+/* subtrees with at least this many terms may be split between threads */
+#define HYPGEOM_PARALLEL_MIN_TERMS 1024
 
 static __inline__ void
 fmpz_poly_evaluate_si(fmpz_t y, const fmpz_poly_t poly, slong x)
@@ -291,6 +297,166 @@ bsplit_recursive_arb(arb_t P, arb_t Q, arb_t B, arb_t T,
     }
 }
 
+typedef struct
+{
+    arb_ptr P;
+    arb_ptr Q;
+    arb_ptr B;
+    arb_ptr T;
+    const hypgeom_struct * hyp;
+    slong a;
+    slong b;
+    int cont;
+    slong prec;
+    slong depth;
+}
+bsplit_work_t;
+
+typedef struct
+{
+    arb_ptr z;
+    arb_srcptr x;
+    arb_srcptr y;
+    arb_srcptr w;
+    slong prec;
+}
+mul_work_t;
+
+/* z = x * y, or z = x * y * w */
+static void
+mul_worker(void * arg_ptr)
+{
+    mul_work_t * arg = (mul_work_t *) arg_ptr;
+
+    arb_mul(arg->z, arg->x, arg->y, arg->prec);
+
+    if (arg->w != NULL)
+        arb_mul(arg->z, arg->z, arg->w, arg->prec);
+}
+
+static void bsplit_worker(void * arg_ptr);
+
+/*
+    Like bsplit_recursive_arb, but in the top depth levels of the tree,
+    the left half is computed by another thread, and the independent
+    products combining the two halves are done in parallel. Only the
+    values on the path from the root to the running subtrees are kept,
+    so the memory use is the same as for the serial version.
+*/
+static void
+bsplit_recursive_arb_threaded(arb_t P, arb_t Q, arb_t B, arb_t T,
+    const hypgeom_t hyp, slong a, slong b, int cont, slong prec, slong depth)
+{
+    slong m, i, num;
+    arb_t P2, Q2, B2, T2, B3;
+    arb_thread_pool_group_t group;
+    bsplit_work_t left;
+    mul_work_t jobs[5];
+    int one;
+
+    if (depth <= 0 || b - a < HYPGEOM_PARALLEL_MIN_TERMS)
+    {
+        bsplit_recursive_arb(P, Q, B, T, hyp, a, b, cont, prec);
+        return;
+    }
+
+    m = (a + b) / 2;
+
+    arb_init(P2);
+    arb_init(Q2);
+    arb_init(B2);
+    arb_init(T2);
+    arb_init(B3);
+
+    left.P = P;
+    left.Q = Q;
+    left.B = B;
+    left.T = T;
+    left.hyp = hyp;
+    left.a = a;
+    left.b = m;
+    left.cont = 1;
+    left.prec = prec;
+    left.depth = depth - 1;
+
+    arb_thread_pool_group_init(group);
+    arb_thread_pool_submit(group, bsplit_worker, &left);
+    bsplit_recursive_arb_threaded(P2, Q2, B2, T2, hyp, m, b, 1, prec, depth - 1);
+    arb_thread_pool_wait(group);
+
+    /* T = T Q2 B2 + T2 P B, Q = Q Q2, P = P P2, B = B B2 */
+    one = arb_is_one(B) && arb_is_one(B2);
+    num = 0;
+
+    jobs[num].z = T;
+    jobs[num].x = T;
+    jobs[num].y = Q2;
+    jobs[num].w = one ? NULL : B2;
+    num++;
+
+    jobs[num].z = T2;
+    jobs[num].x = T2;
+    jobs[num].y = P;
+    jobs[num].w = one ? NULL : B;
+    num++;
+
+    jobs[num].z = Q;
+    jobs[num].x = Q;
+    jobs[num].y = Q2;
+    jobs[num].w = NULL;
+    num++;
+
+    if (cont)
+    {
+        jobs[num].z = P2;
+        jobs[num].x = P;
+        jobs[num].y = P2;
+        jobs[num].w = NULL;
+        num++;
+    }
+
+    if (!one)
+    {
+        jobs[num].z = B3;
+        jobs[num].x = B;
+        jobs[num].y = B2;
+        jobs[num].w = NULL;
+        num++;
+    }
+
+    for (i = 0; i < num; i++)
+        jobs[i].prec = prec;
+
+    for (i = 1; i < num; i++)
+        arb_thread_pool_submit(group, mul_worker, jobs + i);
+    mul_worker(jobs);
+    arb_thread_pool_wait(group);
+    arb_thread_pool_group_clear(group);
+
+    arb_add(T, T, T2, prec);
+
+    if (cont)
+        arb_swap(P, P2);
+
+    if (!one)
+        arb_swap(B, B3);
+
+    arb_clear(P2);
+    arb_clear(Q2);
+    arb_clear(B2);
+    arb_clear(T2);
+    arb_clear(B3);
+}
+
+static void
+bsplit_worker(void * arg_ptr)
+{
+    bsplit_work_t * arg = (bsplit_work_t *) arg_ptr;
+
+    bsplit_recursive_arb_threaded(arg->P, arg->Q, arg->B, arg->T, arg->hyp,
+        arg->a, arg->b, arg->cont, arg->prec, arg->depth);
+}
+
 void
 arb_hypgeom_sum(arb_t P, arb_t Q, const hypgeom_t hyp, slong n, slong prec)
 {
@@ -302,9 +468,22 @@ arb_hypgeom_sum(arb_t P, arb_t Q, const hypgeom_t hyp, slong n, slong prec)
     else
     {
         arb_t B, T;
+        slong num_threads;
+
         arb_init(B);
         arb_init(T);
-        bsplit_recursive_arb(P, Q, B, T, hyp, 0, n, 0, prec);
+
+        num_threads = flint_get_num_threads();
+
+        /* fork in the top levels, giving a few tasks per thread */
+        if (num_threads > 1 && n >= 2 * HYPGEOM_PARALLEL_MIN_TERMS)
+            ARB_INSTR_TIME(ARB_INSTR_HYPGEOM_SUM, n,
+                bsplit_recursive_arb_threaded(P, Q, B, T, hyp, 0, n, 0, prec,
+                    FLINT_BIT_COUNT(num_threads) + 1));
+        else
+            ARB_INSTR_TIME(ARB_INSTR_HYPGEOM_SUM, n,
+                bsplit_recursive_arb(P, Q, B, T, hyp, 0, n, 0, prec));
+
         if (!arb_is_one(B))
             arb_mul(Q, Q, B, prec);
         arb_swap(P, T);
@@ -0,0 +1,95 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("sum....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 40; iter++)
+    {
+        hypgeom_t hyp;
+        arb_t P1, Q1, P2, Q2;
+        slong n, prec;
+
+        hypgeom_init(hyp);
+        arb_init(P1);
+        arb_init(Q1);
+        arb_init(P2);
+        arb_init(Q2);
+
+        /* random series with positive coefficients */
+        fmpz_poly_set_coeff_ui(hyp->A, 0, 1 + n_randint(state, 10));
+        fmpz_poly_set_coeff_ui(hyp->A, 1, n_randint(state, 10));
+        fmpz_poly_set_coeff_ui(hyp->B, 0, 1 + n_randint(state, 2));
+        fmpz_poly_set_coeff_ui(hyp->B, n_randint(state, 2), 1);
+        fmpz_poly_set_coeff_ui(hyp->P, 0, 1 + n_randint(state, 10));
+        fmpz_poly_set_coeff_ui(hyp->P, 1, n_randint(state, 10));
+        fmpz_poly_set_coeff_ui(hyp->Q, 0, n_randint(state, 10));
+        fmpz_poly_set_coeff_ui(hyp->Q, 1, 1 + n_randint(state, 100));
+        fmpz_poly_set_coeff_ui(hyp->Q, 2, n_randint(state, 10));
+
+        n = n_randint(state, 10000);
+        prec = 2 + n_randint(state, 5000);
+
+        flint_set_num_threads(1);
+        arb_hypgeom_sum(P1, Q1, hyp, n, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 8));
+        arb_hypgeom_sum(P2, Q2, hyp, n, prec);
+
+        arb_div(P1, P1, Q1, prec);
+        arb_div(P2, P2, Q2, prec);
+
+        if (!arb_overlaps(P1, P2) ||
+            arb_rel_accuracy_bits(P2) < arb_rel_accuracy_bits(P1) - 10)
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_printf("P1 = "); arb_printd(P1, 50); flint_printf("\n\n");
+            flint_printf("P2 = "); arb_printd(P2, 50); flint_printf("\n\n");
+            abort();
+        }
+
+        hypgeom_clear(hyp);
+        arb_clear(P1);
+        arb_clear(Q1);
+        arb_clear(P2);
+        arb_clear(Q2);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
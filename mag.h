@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2016 Arb authors
 
 ******************************************************************************/
 
@@ -435,6 +436,58 @@ mag_fast_addmul(mag_t z, const mag_t x, const mag_t y)
     }
 }
 
+MAG_INLINE void
+mag_fast_add(mag_t z, const mag_t x, const mag_t y)
+{
+    if (MAG_MAN(x) == 0)
+    {
+        mag_fast_init_set(z, y);
+    }
+    else if (MAG_MAN(y) == 0)
+    {
+        mag_fast_init_set(z, x);
+    }
+    else
+    {
+        slong shift, e;
+        mp_limb_t man;
+
+        shift = MAG_EXP(x) - MAG_EXP(y);
+
+        if (shift == 0)
+        {
+            e = MAG_EXP(x);
+            man = MAG_MAN(x) + MAG_MAN(y);
+        }
+        else if (shift > 0)
+        {
+            e = MAG_EXP(x);
+
+            if (shift >= MAG_BITS)
+                man = MAG_MAN(x) + LIMB_ONE;
+            else
+                man = MAG_MAN(x) + (MAG_MAN(y) >> shift) + LIMB_ONE;
+        }
+        else
+        {
+            shift = -shift;
+            e = MAG_EXP(y);
+
+            if (shift >= MAG_BITS)
+                man = MAG_MAN(y) + LIMB_ONE;
+            else
+                man = MAG_MAN(y) + (MAG_MAN(x) >> shift) + LIMB_ONE;
+        }
+
+        MAG_EXP(z) = e;
+        MAG_MAN(z) = man;
+
+        /* may need two adjustments */
+        MAG_FAST_ADJUST_ONE_TOO_LARGE(z);
+        MAG_FAST_ADJUST_ONE_TOO_LARGE(z);
+    }
+}
+
 MAG_INLINE void
 mag_fast_add_2exp_si(mag_t z, const mag_t x, slong e)
 {
@@ -548,6 +601,12 @@ _mag_vec_clear(mag_ptr v, slong n)
     flint_free(v);
 }
 
+void _mag_vec_add(mag_ptr z, mag_srcptr x, mag_srcptr y, slong len);
+
+void _mag_vec_mul(mag_ptr z, mag_srcptr x, mag_srcptr y, slong len);
+
+void _mag_vec_addmul(mag_ptr z, mag_srcptr x, mag_srcptr y, slong len);
+
 MAG_INLINE void mag_set_d(mag_t z, double x)
 {
     fmpz_t e;
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "mag.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        mag_ptr x, y, z, w;
+        slong i, len, op, expbits;
+        int alias;
+
+        len = n_randint(state, 20);
+        op = n_randint(state, 3);
+        alias = n_randint(state, 3);
+
+        /* mostly small exponents, to exercise the fast code */
+        expbits = n_randint(state, 4) == 0 ? 100 : 6;
+
+        x = _mag_vec_init(len);
+        y = _mag_vec_init(len);
+        z = _mag_vec_init(len);
+        w = _mag_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            if (n_randint(state, 8) == 0)
+                mag_randtest_special(x + i, state, expbits);
+            else
+                mag_randtest(x + i, state, expbits);
+
+            if (n_randint(state, 8) == 0)
+                mag_randtest_special(y + i, state, expbits);
+            else
+                mag_randtest(y + i, state, expbits);
+
+            mag_randtest(z + i, state, expbits);
+
+            if (alias == 1)
+                mag_set(z + i, x + i);
+
+            mag_set(w + i, z + i);
+
+            if (op == 0)
+                mag_add(w + i, x + i, y + i);
+            else if (op == 1)
+                mag_mul(w + i, x + i, y + i);
+            else
+                mag_addmul(w + i, x + i, y + i);
+        }
+
+        if (op == 0)
+            _mag_vec_add(alias == 1 ? x : z, x, y, len);
+        else if (op == 1)
+            _mag_vec_mul(alias == 1 ? x : z, x, y, len);
+        else
+            _mag_vec_addmul(alias == 1 ? x : z, x, y, len);
+
+        for (i = 0; i < len; i++)
+        {
+            mag_srcptr r = (alias == 1) ? x + i : z + i;
+
+            MAG_CHECK_BITS(r)
+
+            if (!mag_equal(r, w + i))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("op = %wd, i = %wd\n\n", op, i);
+                flint_printf("y = "); mag_printd(y + i, 15); flint_printf("\n\n");
+                flint_printf("r = "); mag_printd(r, 15); flint_printf("\n\n");
+                flint_printf("w = "); mag_printd(w + i, 15); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        _mag_vec_clear(x, len);
+        _mag_vec_clear(y, len);
+        _mag_vec_clear(z, len);
+        _mag_vec_clear(w, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
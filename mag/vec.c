@@ -0,0 +1,333 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 Arb authors
+
+******************************************************************************/
+
+#include "mag.h"
+
+/*
+    Elementwise versions of mag_add, mag_mul and mag_addmul, giving
+    identical results. Entries with lagom exponents (and an output whose
+    exponent is not an mpz) are handled without any fmpz arithmetic;
+    when AVX2 is available, four such entries are processed at a time
+    with the exponents and mantissas held in separate registers.
+*/
+
+#if defined(__AVX2__) && FLINT_BITS == 64
+
+#include <immintrin.h>
+
+#define VEC_ONE _mm256_set1_epi64x(1)
+#define VEC_ZERO _mm256_setzero_si256()
+
+/* loads the exponents and mantissas of x[0], ..., x[3]; the entries
+   end up in the order 0, 2, 1, 3, which _mag_vec_store4 undoes */
+static __inline__ void
+_mag_vec_load4(__m256i * e, __m256i * m, mag_srcptr x)
+{
+    __m256i a, b;
+
+    a = _mm256_loadu_si256((const __m256i *) x);
+    b = _mm256_loadu_si256((const __m256i *) (x + 2));
+
+    *e = _mm256_unpacklo_epi64(a, b);
+    *m = _mm256_unpackhi_epi64(a, b);
+}
+
+static __inline__ void
+_mag_vec_store4(mag_ptr x, __m256i e, __m256i m)
+{
+    _mm256_storeu_si256((__m256i *) x, _mm256_unpacklo_epi64(e, m));
+    _mm256_storeu_si256((__m256i *) (x + 2), _mm256_unpackhi_epi64(e, m));
+}
+
+/* nonzero if all exponents are lagom */
+static __inline__ int
+_mag_vec_lagom4(__m256i e)
+{
+    __m256i bad;
+
+    bad = _mm256_or_si256(
+        _mm256_cmpgt_epi64(e, _mm256_set1_epi64x(MAG_MAX_LAGOM_EXP)),
+        _mm256_cmpgt_epi64(_mm256_set1_epi64x(MAG_MIN_LAGOM_EXP), e));
+
+    return _mm256_testz_si256(bad, bad);
+}
+
+/* nonzero if no exponent is an mpz, i.e. the entries can be overwritten */
+static __inline__ int
+_mag_vec_small4(mag_srcptr x)
+{
+    return !COEFF_IS_MPZ(MAG_EXP(x)) && !COEFF_IS_MPZ(MAG_EXP(x + 1)) &&
+           !COEFF_IS_MPZ(MAG_EXP(x + 2)) && !COEFF_IS_MPZ(MAG_EXP(x + 3));
+}
+
+/* MAG_ADJUST_ONE_TOO_LARGE */
+static __inline__ void
+_mag_vec_adjust_large4(__m256i * e, __m256i * m)
+{
+    __m256i t;
+
+    t = _mm256_srli_epi64(*m, MAG_BITS);
+    *m = _mm256_add_epi64(_mm256_srlv_epi64(*m, t), t);
+    *e = _mm256_add_epi64(*e, t);
+}
+
+static __inline__ void
+_mag_vec_add4(__m256i * ze, __m256i * zm,
+    __m256i xe, __m256i xm, __m256i ye, __m256i ym)
+{
+    __m256i shift, sign, xbig, big, small, e, m, t;
+
+    shift = _mm256_sub_epi64(xe, ye);
+    xbig = _mm256_cmpgt_epi64(xe, ye);
+
+    e = _mm256_blendv_epi8(ye, xe, xbig);
+    big = _mm256_blendv_epi8(ym, xm, xbig);
+    small = _mm256_blendv_epi8(xm, ym, xbig);
+
+    /* |shift|; shifting by 64 or more bits gives zero */
+    sign = _mm256_cmpgt_epi64(VEC_ZERO, shift);
+    shift = _mm256_sub_epi64(_mm256_xor_si256(shift, sign), sign);
+
+    /* plus one ulp if anything was shifted out */
+    t = _mm256_andnot_si256(_mm256_cmpeq_epi64(shift, VEC_ZERO), VEC_ONE);
+    m = _mm256_add_epi64(_mm256_add_epi64(big,
+        _mm256_srlv_epi64(small, shift)), t);
+
+    _mag_vec_adjust_large4(&e, &m);
+    _mag_vec_adjust_large4(&e, &m);
+
+    /* zero operands */
+    t = _mm256_cmpeq_epi64(xm, VEC_ZERO);
+    e = _mm256_blendv_epi8(e, ye, t);
+    m = _mm256_blendv_epi8(m, ym, t);
+    t = _mm256_cmpeq_epi64(ym, VEC_ZERO);
+    *ze = _mm256_blendv_epi8(e, xe, t);
+    *zm = _mm256_blendv_epi8(m, xm, t);
+}
+
+/* MAG_FIXMUL, for 30-bit mantissas */
+#define VEC_FIXMUL(x, y) _mm256_srli_epi64(_mm256_mul_epu32(x, y), MAG_BITS)
+
+static __inline__ void
+_mag_vec_mul4(__m256i * ze, __m256i * zm,
+    __m256i xe, __m256i xm, __m256i ye, __m256i ym)
+{
+    __m256i e, m, fix, zero;
+
+    m = _mm256_add_epi64(VEC_FIXMUL(xm, ym), VEC_ONE);
+    fix = _mm256_xor_si256(_mm256_srli_epi64(m, MAG_BITS - 1), VEC_ONE);
+    m = _mm256_sllv_epi64(m, fix);
+    e = _mm256_sub_epi64(_mm256_add_epi64(xe, ye), fix);
+
+    zero = _mm256_or_si256(_mm256_cmpeq_epi64(xm, VEC_ZERO),
+                           _mm256_cmpeq_epi64(ym, VEC_ZERO));
+
+    *ze = _mm256_andnot_si256(zero, e);
+    *zm = _mm256_andnot_si256(zero, m);
+}
+
+static __inline__ void
+_mag_vec_addmul4(__m256i * ze, __m256i * zm,
+    __m256i xe, __m256i xm, __m256i ye, __m256i ym)
+{
+    __m256i e, p, shift, sign, ea, ma, eb, mb, t, pe, pm;
+
+    /* x*y < 2^e */
+    e = _mm256_add_epi64(xe, ye);
+    p = VEC_FIXMUL(xm, ym);
+
+    shift = _mm256_sub_epi64(*ze, e);
+    sign = _mm256_cmpgt_epi64(VEC_ZERO, shift);
+    shift = _mm256_sub_epi64(_mm256_xor_si256(shift, sign), sign);
+
+    /* exponent of z is at least that of x*y */
+    ea = *ze;
+    ma = _mm256_add_epi64(_mm256_add_epi64(*zm,
+        _mm256_srlv_epi64(p, shift)), VEC_ONE);
+
+    /* exponent of x*y is larger */
+    eb = e;
+    mb = _mm256_add_epi64(_mm256_add_epi64(p,
+        _mm256_srlv_epi64(*zm, shift)), _mm256_set1_epi64x(2));
+    t = _mm256_and_si256(_mm256_cmpeq_epi64(
+        _mm256_srli_epi64(mb, MAG_BITS - 1), VEC_ZERO), VEC_ONE);
+    mb = _mm256_sllv_epi64(mb, t);
+    eb = _mm256_sub_epi64(eb, t);
+
+    e = _mm256_blendv_epi8(ea, eb, sign);
+    p = _mm256_blendv_epi8(ma, mb, sign);
+    _mag_vec_adjust_large4(&e, &p);
+
+    /* x or y zero: z is unchanged; z zero: z = x*y */
+    t = _mm256_or_si256(_mm256_cmpeq_epi64(xm, VEC_ZERO),
+                        _mm256_cmpeq_epi64(ym, VEC_ZERO));
+
+    if (!_mm256_testz_si256(t, t))
+    {
+        e = _mm256_blendv_epi8(e, *ze, t);
+        p = _mm256_blendv_epi8(p, *zm, t);
+    }
+
+    t = _mm256_cmpeq_epi64(*zm, VEC_ZERO);
+
+    if (!_mm256_testz_si256(t, t))
+    {
+        _mag_vec_mul4(&pe, &pm, xe, xm, ye, ym);
+        e = _mm256_blendv_epi8(e, pe, t);
+        p = _mm256_blendv_epi8(p, pm, t);
+    }
+
+    *ze = e;
+    *zm = p;
+}
+
+#define MAG_VEC_BLOCK 4
+
+#else
+
+#define MAG_VEC_BLOCK 0
+
+#endif
+
+static __inline__ void
+_mag_vec_add1(mag_ptr z, mag_srcptr x, mag_srcptr y)
+{
+    if (MAG_IS_LAGOM(x) && MAG_IS_LAGOM(y) && !COEFF_IS_MPZ(MAG_EXP(z)))
+        mag_fast_add(z, x, y);
+    else
+        mag_add(z, x, y);
+}
+
+static __inline__ void
+_mag_vec_mul1(mag_ptr z, mag_srcptr x, mag_srcptr y)
+{
+    if (MAG_IS_LAGOM(x) && MAG_IS_LAGOM(y) && !COEFF_IS_MPZ(MAG_EXP(z)))
+        mag_fast_mul(z, x, y);
+    else
+        mag_mul(z, x, y);
+}
+
+static __inline__ void
+_mag_vec_addmul1(mag_ptr z, mag_srcptr x, mag_srcptr y)
+{
+    if (MAG_IS_LAGOM(x) && MAG_IS_LAGOM(y) && MAG_IS_LAGOM(z))
+        mag_fast_addmul(z, x, y);
+    else
+        mag_addmul(z, x, y);
+}
+
+void
+_mag_vec_add(mag_ptr z, mag_srcptr x, mag_srcptr y, slong len)
+{
+    slong i = 0;
+
+#if MAG_VEC_BLOCK
+    for ( ; i + MAG_VEC_BLOCK <= len; i += MAG_VEC_BLOCK)
+    {
+        __m256i xe, xm, ye, ym, ze, zm;
+        slong k;
+
+        _mag_vec_load4(&xe, &xm, x + i);
+        _mag_vec_load4(&ye, &ym, y + i);
+
+        if (_mag_vec_lagom4(xe) && _mag_vec_lagom4(ye) && _mag_vec_small4(z + i))
+        {
+            _mag_vec_add4(&ze, &zm, xe, xm, ye, ym);
+            _mag_vec_store4(z + i, ze, zm);
+        }
+        else
+        {
+            for (k = 0; k < MAG_VEC_BLOCK; k++)
+                _mag_vec_add1(z + i + k, x + i + k, y + i + k);
+        }
+    }
+#endif
+
+    for ( ; i < len; i++)
+        _mag_vec_add1(z + i, x + i, y + i);
+}
+
+void
+_mag_vec_mul(mag_ptr z, mag_srcptr x, mag_srcptr y, slong len)
+{
+    slong i = 0;
+
+#if MAG_VEC_BLOCK
+    for ( ; i + MAG_VEC_BLOCK <= len; i += MAG_VEC_BLOCK)
+    {
+        __m256i xe, xm, ye, ym, ze, zm;
+        slong k;
+
+        _mag_vec_load4(&xe, &xm, x + i);
+        _mag_vec_load4(&ye, &ym, y + i);
+
+        if (_mag_vec_lagom4(xe) && _mag_vec_lagom4(ye) && _mag_vec_small4(z + i))
+        {
+            _mag_vec_mul4(&ze, &zm, xe, xm, ye, ym);
+            _mag_vec_store4(z + i, ze, zm);
+        }
+        else
+        {
+            for (k = 0; k < MAG_VEC_BLOCK; k++)
+                _mag_vec_mul1(z + i + k, x + i + k, y + i + k);
+        }
+    }
+#endif
+
+    for ( ; i < len; i++)
+        _mag_vec_mul1(z + i, x + i, y + i);
+}
+
+void
+_mag_vec_addmul(mag_ptr z, mag_srcptr x, mag_srcptr y, slong len)
+{
+    slong i = 0;
+
+#if MAG_VEC_BLOCK
+    for ( ; i + MAG_VEC_BLOCK <= len; i += MAG_VEC_BLOCK)
+    {
+        __m256i xe, xm, ye, ym, ze, zm;
+        slong k;
+
+        _mag_vec_load4(&xe, &xm, x + i);
+        _mag_vec_load4(&ye, &ym, y + i);
+        _mag_vec_load4(&ze, &zm, z + i);
+
+        if (_mag_vec_lagom4(xe) && _mag_vec_lagom4(ye) && _mag_vec_lagom4(ze))
+        {
+            _mag_vec_addmul4(&ze, &zm, xe, xm, ye, ym);
+            _mag_vec_store4(z + i, ze, zm);
+        }
+        else
+        {
+            for (k = 0; k < MAG_VEC_BLOCK; k++)
+                _mag_vec_addmul1(z + i + k, x + i + k, y + i + k);
+        }
+    }
+#endif
+
+    for ( ; i < len; i++)
+        _mag_vec_addmul1(z + i, x + i, y + i);
+}
@@ -23,8 +23,8 @@
 
 ******************************************************************************/
 
-#include <pthread.h>
 #include "partitions.h"
+#include "arb_thread_pool.h"
 
 /* defined in flint*/
 #define NUMBER_OF_SMALL_PARTITIONS 128
@@ -42,13 +42,11 @@ typedef struct
 }
 worker_arg_t;
 
-static void *
+static void
 worker(void * arg_ptr)
 {
     worker_arg_t arg = *((worker_arg_t *) arg_ptr);
     partitions_hrr_sum_arb(arg.x, arg.n, arg.N0, arg.N, arg.use_doubles);
-    flint_cleanup();
-    return NULL;
 }
 
 /* TODO: set number of threads in child threads, for future
@@ -57,7 +55,6 @@ static void
 hrr_sum_threaded(arb_t x, const fmpz_t n, slong N, int use_doubles)
 {
     arb_t y;
-    pthread_t threads[2];
     worker_arg_t args[2];
 
     arb_init(y);
@@ -74,11 +71,7 @@ hrr_sum_threaded(arb_t x, const fmpz_t n, slong N, int use_doubles)
     args[1].N = N;
     args[1].use_doubles = use_doubles;
 
-    pthread_create(&threads[0], NULL, worker, &args[0]);
-    pthread_create(&threads[1], NULL, worker, &args[1]);
-
-    pthread_join(threads[0], NULL);
-    pthread_join(threads[1], NULL);
+    arb_thread_pool_run(worker, args, sizeof(worker_arg_t), 2);
 
     arb_add(x, x, y, ARF_PREC_EXACT);
 